@@ -2,12 +2,13 @@
 #include "DxLib.h"
 #include "SceneTitle.h"
 #include "Application.h"
+#include "AtlasManager.h"
 
 AnyPushButton::AnyPushButton(SceneTitle& scene) :
 	_frame(0)
 {
 	// 摜̃[h
-	_textHandle = LoadGraph("data/image/PressAnyButton.png");
+	_textHandle = AtlasManager::GetInstance().LoadGraph("data/image/PressAnyButton.png");
 
 	// \ʒu̐ݒ
 	_dispPos = Vec2{ scene.GetConstantInt("TEXT_POS_X"),scene.GetConstantInt("TEXT_POS_Y") };
@@ -15,7 +16,7 @@ AnyPushButton::AnyPushButton(SceneTitle& scene) :
 
 AnyPushButton::~AnyPushButton()
 {
-	DeleteGraph(_textHandle);
+	AtlasManager::GetInstance().DeleteGraph(_textHandle);
 }
 
 void AnyPushButton::Update()
@@ -11,16 +11,127 @@
 #include "PlayerManager.h"
 #include "SceneResult.h"
 #include "ScenePve.h"
+#include "ScenePvp.h"
 #include "EffectManager.h"
+#include "AtlasManager.h"
+#include "ModelManager.h"
+#include "AssetLoader.h"
+#include "TraceRecorder.h"
+#include "StartupGraph.h"
+#include "FramePacer.h"
+#include "GpuTimer.h"
+#include "FixedTimestep.h"
+#include "JobSystem.h"
+#include "InputSampler.h"
+#include "LatencyTracker.h"
 #include "resource.h"
 #include "SceneSelectMode.h"
 #include "SceneTutorial.h"
+#include <algorithm>
+#include <ctime>
+#ifdef _WIN32
+#include "ArchiveManager.h"
+#endif
 
 bool Application::Init()
 {
+	TraceScope initTrace("Application::Init", "init");
+
 	// Ot@C萔擾
 	ReadCSV("data/constant/Application.csv");
 
+	// ˑ֌WƂɕׁAˑȂ͓̂ɐi߂
+	// CXbĥ̂́AɎsłΐɒǉ̂s
+	StartupGraph graph;
+
+	// EBhE̐ݒ(Dxlib̏Oɍs)
+	graph.Add("Window", StartupGraph::Thread::Main, {}, [this]() {
+		InitWindow();
+		return true;
+	});
+
+	// 񓯊ǂݍ݂̏(Xbh̐ݒDxlib̏Oɍs)
+	graph.Add("AssetLoader::Init", StartupGraph::Thread::Main, {}, []() {
+		AssetLoader::GetInstance().Init();
+		return true;
+	});
+
+	// Q[̍XV̎dsXbh𗧂Ă
+	graph.Add("JobSystem::Init", StartupGraph::Thread::Main, {}, []() {
+		JobSystem::GetInstance().Init();
+		return true;
+	});
+
+	// pbh̓͂ǂރXbh𗧂Ă
+	graph.Add("InputSampler::Init", StartupGraph::Thread::Main, {}, []() {
+		InputSampler::GetInstance().Init();
+		return true;
+	});
+
+	// pbh̔ԍƂɓ͑u蓖Ă
+	graph.Add("Input::Init", StartupGraph::Thread::Main, { "InputSampler::Init" }, []() {
+		Input::GetInstance().Init();
+		return true;
+	});
+
+	// e}l[W[̒萔t@C̉
+	graph.Add("PreloadCSV", StartupGraph::Thread::Worker, { "AssetLoader::Init" }, []() {
+		Constant::Preload("data/constant/SoundManager.csv");
+		Constant::Preload("data/constant/EffectManager.csv");
+		return true;
+	});
+
+	// AgX̃CfbNX̉
+	graph.Add("AtlasIndex", StartupGraph::Thread::Worker, { "AssetLoader::Init" }, []() {
+		AtlasManager::GetInstance();
+		return true;
+	});
+
+	// Dxlib̏
+	graph.Add("DxLib_Init", StartupGraph::Thread::Main, { "Window", "AssetLoader::Init" }, []() {
+		return DxLib_Init() != -1;
+	});
+
+	// AZbg̃A[JCu΃}bvāAȍ~̓ǂݍ݂s
+	// (Ȃ΃tH_̃t@Ĉ܂ܓǂݍ)
+	// (A[JCuDxLib̓ǂݍ݂ɍނ̂Ȃ̂ŁAWindowsłg)
+	graph.Add("ArchiveManager::Mount", StartupGraph::Thread::Main, { "DxLib_Init" }, []() {
+#ifdef _WIN32
+		ArchiveManager::GetInstance().Mount("data.pak");
+#endif
+		return true;
+	});
+
+	// `Ȃǂ̐ݒ
+	graph.Add("Screen", StartupGraph::Thread::Main, { "DxLib_Init" }, [this]() {
+		InitScreen();
+		return true;
+	});
+
+	// ^Cg̃AZbg̐ǂ
+	// 摜EfDxlib̔񓯊ǂݍ݃XbhŁATEhEGtFNg̏Ɠɓǂݍ܂
+	graph.Add("PreloadSceneTitle", StartupGraph::Thread::Main, { "ArchiveManager::Mount", "AtlasIndex" }, []() {
+		AssetLoader::GetInstance().Request("data/manifest/SceneTitle.csv");
+		return true;
+	});
+
+	// TEh}l[W[̏
+	graph.Add("SoundManager::Init", StartupGraph::Thread::Main, { "ArchiveManager::Mount", "PreloadCSV" }, []() {
+		SoundManager::GetInstance().Init();
+		return true;
+	});
+
+	// GtFNg}l[W[̏
+	graph.Add("EffectManager::Init", StartupGraph::Thread::Main, { "Screen", "ArchiveManager::Mount", "PreloadCSV" }, []() {
+		EffectManager::GetInstance().Init();
+		return true;
+	});
+
+	return graph.Run();
+}
+
+void Application::InitWindow()
+{
 	// EBhE[h̐ݒ
 	ChangeWindowMode(true);
 
@@ -63,9 +174,12 @@ bool Application::Init()
 	// obNOEhł삷悤ɂ
 	SetAlwaysRunFlag(true);
 
-	// Dxlib̏
-	if (DxLib_Init() == -1) return false;
+	// ʂ̐؂ւŐ҂(120fpsȂœƂ͑҂Ȃ)
+	SetWaitVSyncFlag(GetConstatBool("WAIT_VSYNC"));
+}
 
+void Application::InitScreen()
+{
 	// tXN[EChE̐؂ւŃ\[X̂hB
 	SetChangeScreenModeGraphicsSystemResetFlag(FALSE);
 
@@ -86,13 +200,8 @@ bool Application::Init()
 	// Zobt@ւ݂̏LɂB
 	SetWriteZBuffer3D(TRUE);
 
-	// TEh}l[W[̏
-	SoundManager::GetInstance().Init();
-
-	// GtFNg}l[W[̏
-	EffectManager::GetInstance().Init();
-
-	return true;
+	// V[ɔj悤Af}l[W[ɍĂ
+	ModelManager::GetInstance();
 }
 
 void Application::Run()
@@ -101,16 +210,48 @@ void Application::Run()
 	auto& manager = SceneManager::GetInstance();
 
 	// V[ݒ
-	manager.ChangeScene(std::make_shared <SceneTitle>(false));
+	// (SOAK_PLAYER_NUM2ȏȂA^Cg΂Ă̐lőΐn߂
+	//  Rg[[Ȃŉ񂵑Ƃ́AInput.csvŉz̃pbh蓖Ă)
+	int soakPlayerNum = GetConstantInt("SOAK_PLAYER_NUM");
+	if (soakPlayerNum >= 2) {
+		StartMatch(soakPlayerNum);
+	}
+	else {
+		TraceScope trace("SceneTitle", "scene");
+		manager.ChangeScene(std::make_shared <SceneTitle>(false));
+	}
+
+	// t[̊Jn낦
+	_pFramePacer = std::make_shared<FramePacer>();
 
-	// Cvbg̃CX^X擾
-	auto& input = Input::GetInstance();
+	// 𑜓x߂邽߂ɁAGPU̕`掞Ԃ𑪂
+	_pGpuTimer = std::make_shared<GpuTimer>();
+
+	// NԂ̋L^(ŏ̃t[o珑oďI)
+	auto& trace = TraceRecorder::GetInstance();
+	bool isFirstFrame = true;
+
+	// Ñt[̋L^(XbhƂ̎d̕)
+	int traceFrameNum = GetConstantInt("TRACE_FRAME_NUM");
+
+	// e{^Ăʂɏo܂ł̎Ԃ̌v
+	auto& latency = LatencyTracker::GetInstance();
 
 	// Q[[v
 	while (ProcessMessage() != -1)
 	{
 		// t[̊JnoĂ
 		LONGLONG start = GetNowHiPerformanceCount();
+		long long traceStart = isFirstFrame ? trace.GetTime() : 0;
+
+		/*Q[*/
+
+		// XV
+		// (DxLibEffekseer̓XbhZ[tł͂Ȃ̂ŁAXVƕ`͓XbhŌ݂ɍs)
+		Simulate();
+
+		// GPU̕`掞Ԃ𑪂
+		_pGpuTimer->Begin();
 
 		// Zobt@gpď
 		SetUseZBuffer3D(true);
@@ -119,16 +260,47 @@ void Application::Run()
 		// `sOɉʂNA
 		ClearDrawScreen();
 
-		/*Q[*/
+		// O2eBbN̊ԂԂĕ`悷
+		{
+			TraceScope drawTrace("SceneDraw", "frame");
+			latency.OnDraw();
+			manager.SceneDraw();
+		}
 
-		// XV
-		input.Update();
-		manager.SceneUpdate();
+		// ͂̒x̃qXgO
+		latency.DrawOverlay();
+
+		// ܂Ă`oĂAGPU̕`掞Ԃ̌vI
+		RenderVertex();
+		_pGpuTimer->End();
 
-		manager.SceneDraw();
+		// ҂܂܂ȂԂoĂ
+		_frameTime = GetNowHiPerformanceCount() - start;
 
 		// ʂ؂ւ̂҂
 		ScreenFlip();
+		latency.OnFlip();
+
+		// 𑜓xGPU̕`掞ԂŌ߂(CPȔԂ͉𑜓xĂȂ)
+		// Ȃ΁AScreenFlip̑O܂ł̏Ԃőɂ
+		// (ScreenFlip܂Ŋ܂߂Ɛ҂łڕWԂ𒴂A𑜓x葱)
+		_gpuTime = _pGpuTimer->GetTime();
+		if (_gpuTime < 0) {
+			_gpuTime = _frameTime;
+		}
+
+		// 󂯕tŏ̃t[o܂ło
+		if (isFirstFrame) {
+			isFirstFrame = false;
+			trace.AddSpan("FirstFrame", "frame", "", traceStart, trace.GetTime());
+			trace.Finish(GetConstatBool("TRACE_STARTUP") ? STARTUP_TRACE_PATH : "");
+
+			if (traceFrameNum > 0) trace.Start();
+		}
+		// ߂t[L^珑o
+		else if (traceFrameNum > 0 && --traceFrameNum == 0) {
+			trace.Finish(FRAME_TRACE_PATH);
+		}
 
 		// manager̃tOŃQ[I
 		if (manager.GetGameEnd()) break;
@@ -138,16 +310,182 @@ void Application::Run()
 			break;
 		}
 
-		// fps60ɌŒ肷(1t[  16.667ms)
-		while (GetNowHiPerformanceCount() - start < 16667) {}
+		// ̃t[̊Jn܂ő҂
+		_pFramePacer->Wait();
 	}
 
 	// Is
 	Terminate();
 }
 
+void Application::Simulate()
+{
+	TraceScope trace("Simulate", "frame");
+
+	auto& manager = SceneManager::GetInstance();
+	auto& timestep = FixedTimestep::GetInstance();
+
+	// ǂ݂̐is
+	AssetLoader::GetInstance().Update();
+
+	// o߂Ԃ̕eBbNi߂(`悪0̂Ƃ)
+	int tickNum = timestep.Advance();
+
+	// eBbNƂɁÃeBbN̏I܂łɓ͂g
+	long long inputTime = InputSampler::GetTime();
+
+	for (int i = 0; i < tickNum; i++) {
+		timestep.BeginTick();
+
+		Tick(inputTime - timestep.GetTickDuration() * (tickNum - 1 - i));
+
+		if (manager.GetGameEnd()) break;
+	}
+}
+
+void Application::Tick(long long tickTime)
+{
+	Input::GetInstance().Update(tickTime);
+	SceneManager::GetInstance().SceneUpdate();
+
+	// ̃eBbNɐς܂ꂽSE炷
+	SoundManager::GetInstance().Update();
+
+	// GtFNgi߂
+	EffectManager::GetInstance().Update();
+}
+
+void Application::StartMatch(int playerNum)
+{
+	TraceScope trace("ScenePvp", "scene");
+
+	PlayerData data;
+	data.playerNum = std::clamp(playerNum, 2, MAX_PAD_NUM) - 1;
+	for (int i = 0; i < MAX_PAD_NUM; i++) {
+		data.character[i] = i;
+	}
+
+	AssetLoader::GetInstance().Request("data/manifest/ScenePvp.csv");
+	SceneManager::GetInstance().ChangeScene(std::make_shared<ScenePvp>(data));
+}
+
+bool Application::RunHeadless()
+{
+	auto& manager = SceneManager::GetInstance();
+	auto& timestep = FixedTimestep::GetInstance();
+
+	// ŏ̃t[oȂ̂ŁANԂ̋L^͂ł߂
+	TraceRecorder::GetInstance().Finish(GetConstatBool("TRACE_STARTUP") ? STARTUP_TRACE_PATH : "");
+
+	// Rg[[͂Ȃ̂ŁAׂẴpbhXNvg̉z̃pbhœ
+	for (int i = 0; i < MAX_PAD_NUM; i++) {
+		Input::GetInstance().SetScriptDevice(i);
+	}
+
+	// 킩n߁AĐ킪1ڂƓɂȂ邩m߂
+	_matchSeed = static_cast<unsigned int>(GetConstantInt("HEADLESS_MATCH_SEED"));
+
+	// ߂̓vC[̍XVXbhɕɍsǍʂɂ
+	// (RA1̃}VłXbhɕXV悤A㔼̓Xbh̐߂ĕ)
+	int workerNum = GetConstantInt("HEADLESS_WORKER_NUM");
+	_isParallelUpdate = false;
+
+	StartMatch(GetConstantInt("HEADLESS_PLAYER_NUM"));
+
+	int serialMatchNum = GetConstantInt("HEADLESS_MATCH_NUM");
+	int matchNum = workerNum > 0 ? serialMatchNum * 2 : serialMatchNum;
+	int maxTick = GetConstantInt("HEADLESS_MAX_TICK");
+
+	// ҂Ɏ̃eBbNi߂
+	// ͂̎́AeBbN̊Ԋui߂̎g
+	long long start = GetNowHiPerformanceCount();
+	long long tickTime = InputSampler::GetTime();
+	int tick = 0;
+
+	while (_matchNum < matchNum && tick < maxTick && !manager.GetGameEnd()) {
+		// ɍsIAXbhɕēΐ킷
+		if (!_isParallelUpdate && workerNum > 0 && _matchNum == serialMatchNum) {
+			JobSystem::GetInstance().SetWorkerNum(workerNum);
+			_isParallelUpdate = true;
+			LogFileFmtAdd("Headless: parallel update with %d workers", workerNum);
+		}
+
+		AssetLoader::GetInstance().Update();
+
+		timestep.BeginTick();
+		tickTime += timestep.GetTickDuration();
+		Tick(tickTime);
+
+		tick++;
+	}
+
+	long long elapsed = (std::max)(GetNowHiPerformanceCount() - start, 1LL);
+	LogFileFmtAdd("Headless: %d matches, %d ticks in %lld ms (%.0f ticks/s)",
+		_matchNum, tick, elapsed / 1000, tick * 1000000.0 / elapsed);
+	if (_mismatchNum > 0) {
+		LogFileFmtAdd("Headless: %d of %d matches differ from match 1", _mismatchNum, _matchNum);
+	}
+
+	// Is
+	Terminate();
+
+	return _mismatchNum == 0;
+}
+
+void Application::OnMatchEnd(int winner, int gameTime)
+{
+	_matchNum++;
+	LogFileFmtAdd("Match %d: winner %d, %d ticks", _matchNum, winner, gameTime);
+
+	// Đ́ȀԂ߂Ă1ڂƓʂɂȂ
+	if (_matchNum == 1) {
+		_firstWinner = winner;
+		_firstGameTime = gameTime;
+	}
+	else if (_matchSeed != 0 && (winner != _firstWinner || gameTime != _firstGameTime)) {
+		_mismatchNum++;
+		LogFileFmtAdd("Match %d: differs from match 1 (winner %d, %d ticks)", _matchNum, _firstWinner, _firstGameTime);
+	}
+}
+
+long long Application::GetFrameTime() const
+{
+	return _frameTime;
+}
+
+long long Application::GetGpuTime() const
+{
+	return _gpuTime;
+}
+
+unsigned int Application::GetMatchSeed() const
+{
+	return _matchSeed != 0 ? _matchSeed : static_cast<unsigned int>(time(nullptr));
+}
+
+bool Application::IsParallelUpdate() const
+{
+	return _isParallelUpdate;
+}
+
+std::shared_ptr<FramePacer> Application::GetFramePacer() const
+{
+	return _pFramePacer;
+}
+
 void Application::Terminate()
 {
+	if (_pFramePacer) _pFramePacer->Report();
+	LatencyTracker::GetInstance().Export(LATENCY_CSV_PATH);
+	JobSystem::GetInstance().Report();
+	JobSystem::GetInstance().Terminate();
+	InputSampler::GetInstance().Terminate();
+	AssetLoader::GetInstance().Terminate();
 	EffectManager::GetInstance().Terminate();
+	AtlasManager::GetInstance().DeletePage();
+	SceneManager::GetInstance().Terminate();
 	DxLib_End();    // DXCȕI
+#ifdef _WIN32
+	ArchiveManager::GetInstance().Unmount();
+#endif
 }
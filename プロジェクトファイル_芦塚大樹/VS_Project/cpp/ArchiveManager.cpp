@@ -0,0 +1,432 @@
+#include "ArchiveManager.h"
+#include <cstdio>
+#include <cstring>
+
+// Gg[̃tO
+constexpr unsigned int ARCHIVE_FLAG_LZ4 = 1;	// LZ4ňkĂ
+
+// ΉĂA[JCũo[W
+constexpr unsigned int ARCHIVE_VERSION = 1;
+
+// ODDS΍ւ摜̊gq
+constexpr const char* TEXTURE_EXTENSION[] = { ".png", ".jpg", ".bmp", ".tga" };
+
+ArchiveManager::ArchiveManager() :
+	_fileHandle(INVALID_HANDLE_VALUE),
+	_mappingHandle(nullptr),
+	_view(nullptr),
+	_viewSize(0),
+	_isHooked(false)
+{
+}
+
+ArchiveManager::~ArchiveManager()
+{
+	Unmount();
+}
+
+bool ArchiveManager::Mount(const std::string& path)
+{
+	Unmount();
+
+	// A[JCuȂĂA摜DDSɍւ邽߂DxLib̓ǂݍ݂͂̃NXɌ
+	bool isMapped = MapArchive(path);
+
+	STREAMDATASHREDTYPE2 stream;
+	stream.Open = StreamOpen;
+	stream.Close = StreamClose;
+	stream.Tell = StreamTell;
+	stream.Seek = StreamSeek;
+	stream.Read = StreamRead;
+	stream.Eof = StreamEof;
+	stream.IdleCheck = StreamIdleCheck;
+	stream.ChDir = StreamChDir;
+	stream.GetDir = StreamGetDir;
+	stream.GetDirS = StreamGetDirS;
+	stream.FindFirst = StreamFindFirst;
+	stream.FindNext = StreamFindNext;
+	stream.FindClose = StreamFindClose;
+	ChangeStreamFunction(&stream);
+	_isHooked = true;
+
+	return isMapped;
+}
+
+bool ArchiveManager::MapArchive(const std::string& path)
+{
+	// A[JCuJĂ܂邲ƃ}bv
+	_fileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (_fileHandle == INVALID_HANDLE_VALUE) return false;
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(_fileHandle, &fileSize) || fileSize.QuadPart < static_cast<LONGLONG>(sizeof(Header))) {
+		Unmount();
+		return false;
+	}
+
+	_mappingHandle = CreateFileMappingA(_fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (_mappingHandle == nullptr) {
+		Unmount();
+		return false;
+	}
+
+	_view = static_cast<const unsigned char*>(MapViewOfFile(_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+	if (_view == nullptr) {
+		Unmount();
+		return false;
+	}
+	_viewSize = static_cast<unsigned long long>(fileSize.QuadPart);
+
+	// wb_̊mF
+	Header header;
+	memcpy(&header, _view, sizeof(Header));
+	if (memcmp(header.magic, "PAK1", 4) != 0 || header.version != ARCHIVE_VERSION ||
+		header.indexOffset + header.indexSize > _viewSize) {
+		Unmount();
+		return false;
+	}
+
+	// CfbNXǂ
+	// (pX̒2byteAtO2byteACRC32 4byteAʒuEi[TCYEWJTCYe8byteApX)
+	const unsigned char* index = _view + header.indexOffset;
+	const unsigned char* indexEnd = index + header.indexSize;
+	for (unsigned int i = 0; i < header.entryNum; i++) {
+		constexpr size_t ENTRY_HEAD_SIZE = 2 + 2 + 4 + 8 + 8 + 8;
+		if (index + ENTRY_HEAD_SIZE > indexEnd) break;
+
+		unsigned short pathLength = 0;
+		unsigned short flags = 0;
+		Entry entry;
+		memcpy(&pathLength, index, 2);
+		memcpy(&flags, index + 2, 2);
+		memcpy(&entry.crc, index + 4, 4);
+		memcpy(&entry.offset, index + 8, 8);
+		memcpy(&entry.storedSize, index + 16, 8);
+		memcpy(&entry.size, index + 24, 8);
+		entry.flags = flags;
+		index += ENTRY_HEAD_SIZE;
+
+		if (index + pathLength > indexEnd) break;
+		std::string entryPath(reinterpret_cast<const char*>(index), pathLength);
+		index += pathLength;
+
+		// ͈͊OwĂ͎̂gȂ
+		if (entry.offset + entry.storedSize > _viewSize) continue;
+
+		_entry[NormalizePath(entryPath.c_str())] = entry;
+	}
+
+	return true;
+}
+
+void ArchiveManager::Unmount()
+{
+	// DxLib̊̓ǂݍ݂ɖ߂
+	if (_isHooked) {
+		ChangeStreamFunction(nullptr);
+		_isHooked = false;
+	}
+
+	_entry.clear();
+
+	if (_view != nullptr) {
+		UnmapViewOfFile(_view);
+		_view = nullptr;
+	}
+	if (_mappingHandle != nullptr) {
+		CloseHandle(_mappingHandle);
+		_mappingHandle = nullptr;
+	}
+	if (_fileHandle != INVALID_HANDLE_VALUE) {
+		CloseHandle(_fileHandle);
+		_fileHandle = INVALID_HANDLE_VALUE;
+	}
+	_viewSize = 0;
+}
+
+bool ArchiveManager::Contains(const std::string& path) const
+{
+	return _entry.find(NormalizePath(path.c_str())) != _entry.end();
+}
+
+std::string ArchiveManager::NormalizePath(const char* path)
+{
+	std::string result;
+	for (const char* p = path; *p != '\0'; p++) {
+		unsigned char c = static_cast<unsigned char>(*p);
+
+		// Shift-JIS2oCg2oCgڂϊȂ悤ɂ̂܂܎ʂ
+		if ((c >= 0x81 && c <= 0x9f) || (c >= 0xe0 && c <= 0xfc)) {
+			result += *p;
+			if (p[1] != '\0') {
+				result += *++p;
+			}
+			continue;
+		}
+
+		if (c == '\\') c = '/';
+		if (c >= 'A' && c <= 'Z') c = c - 'A' + 'a';
+		result += static_cast<char>(c);
+	}
+
+	// 擪"./"菜
+	while (result.compare(0, 2, "./") == 0) {
+		result.erase(0, 2);
+	}
+
+	return result;
+}
+
+std::string ArchiveManager::FindCompressedTexture(const char* path) const
+{
+	// gq摜ׂ̂̂
+	// ('.'Shift-JIS2oCgڂɗȂ̂ł̂܂ܒTĂ悢)
+	const char* extension = strrchr(path, '.');
+	if (extension == nullptr) return "";
+
+	bool isTexture = false;
+	for (auto& textureExtension : TEXTURE_EXTENSION) {
+		if (_stricmp(extension, textureExtension) == 0) {
+			isTexture = true;
+			break;
+		}
+	}
+	if (!isTexture) return "";
+
+	// A[JCutH_ɓODDS邩
+	std::string ddsPath = std::string(path, extension) + ".dds";
+	if (_entry.find(NormalizePath(ddsPath.c_str())) != _entry.end() ||
+		GetFileAttributesA(ddsPath.c_str()) != INVALID_FILE_ATTRIBUTES) {
+		return ddsPath;
+	}
+
+	return "";
+}
+
+bool ArchiveManager::DecodeLz4(const unsigned char* src, size_t srcSize, unsigned char* dst, size_t dstSize)
+{
+	const unsigned char* ip = src;
+	const unsigned char* ipEnd = src + srcSize;
+	unsigned char* op = dst;
+	unsigned char* opEnd = dst + dstSize;
+
+	while (ip < ipEnd) {
+		// 4bite̒A4bitv̒
+		unsigned int token = *ip++;
+
+		// eRs[
+		size_t literal = token >> 4;
+		if (literal == 15) {
+			unsigned int add = 255;
+			while (add == 255 && ip < ipEnd) {
+				add = *ip++;
+				literal += add;
+			}
+		}
+		if (literal > static_cast<size_t>(ipEnd - ip) || literal > static_cast<size_t>(opEnd - op)) return false;
+		memcpy(op, ip, literal);
+		ip += literal;
+		op += literal;
+
+		// Ō̃V[PX̓eŏI
+		if (ip >= ipEnd) break;
+
+		// vʒuǂ
+		if (ipEnd - ip < 2) return false;
+		size_t offset = ip[0] | (ip[1] << 8);
+		ip += 2;
+		if (offset == 0 || offset > static_cast<size_t>(op - dst)) return false;
+
+		size_t match = token & 15;
+		if (match == 15) {
+			unsigned int add = 255;
+			while (add == 255 && ip < ipEnd) {
+				add = *ip++;
+				match += add;
+			}
+		}
+		match += 4;
+		if (match > static_cast<size_t>(opEnd - op)) return false;
+
+		// dȂĂꍇ̂1byteRs[
+		const unsigned char* from = op - offset;
+		for (size_t i = 0; i < match; i++) {
+			op[i] = from[i];
+		}
+		op += match;
+	}
+
+	return op == opEnd;
+}
+
+DWORD_PTR ArchiveManager::StreamOpen(const TCHAR* path, int useCacheFlag, int blockReadFlag, int useASyncReadFlag)
+{
+	auto& manager = GetInstance();
+
+	// ubNkDDS΂J(DxLib͒gŉ摜̌`𔻒f)
+	std::string texturePath = manager.FindCompressedTexture(path);
+	if (!texturePath.empty()) {
+		path = texturePath.c_str();
+	}
+
+	// A[JCuɓĂ΃}bv̈𒼐ړǂ
+	auto it = manager._entry.find(NormalizePath(path));
+	if (it != manager._entry.end()) {
+		const Entry& entry = it->second;
+		Stream* stream = new Stream();
+		stream->size = static_cast<long long>(entry.size);
+
+		if (entry.flags & ARCHIVE_FLAG_LZ4) {
+			// kĂ̂͊JƂɓWJ
+			stream->buffer.resize(entry.size);
+			if (!DecodeLz4(manager._view + entry.offset, entry.storedSize, stream->buffer.data(), stream->buffer.size())) {
+				delete stream;
+				return 0;
+			}
+			stream->data = stream->buffer.data();
+		}
+		else {
+			stream->data = manager._view + entry.offset;
+		}
+
+		return reinterpret_cast<DWORD_PTR>(stream);
+	}
+
+	// A[JCuɂȂt@C̓tH_J
+	HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE) return 0;
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize)) {
+		CloseHandle(file);
+		return 0;
+	}
+
+	Stream* stream = new Stream();
+	stream->looseFile = file;
+	stream->size = fileSize.QuadPart;
+
+	return reinterpret_cast<DWORD_PTR>(stream);
+}
+
+int ArchiveManager::StreamClose(DWORD_PTR handle)
+{
+	Stream* stream = reinterpret_cast<Stream*>(handle);
+	if (stream->looseFile != INVALID_HANDLE_VALUE) {
+		CloseHandle(stream->looseFile);
+	}
+	delete stream;
+	return 0;
+}
+
+LONGLONG ArchiveManager::StreamTell(DWORD_PTR handle)
+{
+	return reinterpret_cast<Stream*>(handle)->position;
+}
+
+int ArchiveManager::StreamSeek(DWORD_PTR handle, LONGLONG seekPoint, int seekType)
+{
+	Stream* stream = reinterpret_cast<Stream*>(handle);
+
+	long long position = seekPoint;
+	if (seekType == SEEK_CUR) position += stream->position;
+	if (seekType == SEEK_END) position += stream->size;
+	if (position < 0) position = 0;
+	if (position > stream->size) position = stream->size;
+	stream->position = position;
+
+	// tH_Jt@C͎ۂ̓ǂݍ݈ʒu
+	if (stream->looseFile != INVALID_HANDLE_VALUE) {
+		LARGE_INTEGER move;
+		move.QuadPart = position;
+		SetFilePointerEx(stream->looseFile, move, nullptr, FILE_BEGIN);
+	}
+
+	return 0;
+}
+
+size_t ArchiveManager::StreamRead(void* buffer, size_t blockSize, size_t dataNum, DWORD_PTR handle)
+{
+	Stream* stream = reinterpret_cast<Stream*>(handle);
+	if (blockSize == 0) return 0;
+
+	// c̃TCYɎ܂ubNǂ
+	size_t rest = static_cast<size_t>(stream->size - stream->position);
+	size_t readNum = dataNum < rest / blockSize ? dataNum : rest / blockSize;
+	size_t readSize = readNum * blockSize;
+
+	if (stream->looseFile != INVALID_HANDLE_VALUE) {
+		DWORD done = 0;
+		if (!ReadFile(stream->looseFile, buffer, static_cast<DWORD>(readSize), &done, nullptr)) return 0;
+		stream->position += done;
+		return done / blockSize;
+	}
+
+	memcpy(buffer, stream->data + stream->position, readSize);
+	stream->position += readSize;
+	return readNum;
+}
+
+int ArchiveManager::StreamEof(DWORD_PTR handle)
+{
+	Stream* stream = reinterpret_cast<Stream*>(handle);
+	return stream->position >= stream->size ? TRUE : FALSE;
+}
+
+int ArchiveManager::StreamIdleCheck(DWORD_PTR handle)
+{
+	// ǂݍׂ݂͂ēȂ̂ŏɊĂ
+	return TRUE;
+}
+
+int ArchiveManager::StreamChDir(const TCHAR* path)
+{
+	return SetCurrentDirectoryA(path) ? 0 : -1;
+}
+
+int ArchiveManager::StreamGetDir(TCHAR* buffer)
+{
+	return GetCurrentDirectoryA(MAX_PATH, buffer) != 0 ? 0 : -1;
+}
+
+int ArchiveManager::StreamGetDirS(TCHAR* buffer, size_t bufferSize)
+{
+	return GetCurrentDirectoryA(static_cast<DWORD>(bufferSize), buffer) != 0 ? 0 : -1;
+}
+
+DWORD_PTR ArchiveManager::StreamFindFirst(const TCHAR* filePath, FILEINFO* buffer)
+{
+	// ̓tH_ɑ΂Ăs
+	WIN32_FIND_DATAA data;
+	HANDLE find = FindFirstFileA(filePath, &data);
+	if (find == INVALID_HANDLE_VALUE) return static_cast<DWORD_PTR>(-1);
+
+	if (buffer != nullptr) {
+		memset(buffer, 0, sizeof(FILEINFO));
+		strncpy_s(buffer->Name, data.cFileName, _TRUNCATE);
+		buffer->DirFlag = (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) ? TRUE : FALSE;
+		buffer->Size = (static_cast<LONGLONG>(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+	}
+
+	return reinterpret_cast<DWORD_PTR>(find);
+}
+
+int ArchiveManager::StreamFindNext(DWORD_PTR findHandle, FILEINFO* buffer)
+{
+	WIN32_FIND_DATAA data;
+	if (!FindNextFileA(reinterpret_cast<HANDLE>(findHandle), &data)) return -1;
+
+	if (buffer != nullptr) {
+		memset(buffer, 0, sizeof(FILEINFO));
+		strncpy_s(buffer->Name, data.cFileName, _TRUNCATE);
+		buffer->DirFlag = (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) ? TRUE : FALSE;
+		buffer->Size = (static_cast<LONGLONG>(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+	}
+
+	return 0;
+}
+
+int ArchiveManager::StreamFindClose(DWORD_PTR findHandle)
+{
+	return FindClose(reinterpret_cast<HANDLE>(findHandle)) ? 0 : -1;
+}
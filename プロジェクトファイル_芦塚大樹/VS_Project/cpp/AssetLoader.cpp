@@ -0,0 +1,208 @@
+#include "AssetLoader.h"
+#include "DxLib.h"
+#include "AtlasManager.h"
+#include "ModelManager.h"
+#include "EffectManager.h"
+#include "TraceRecorder.h"
+#include <fstream>
+#include <sstream>
+
+AssetLoader::AssetLoader() :
+	_doneNum(0),
+	_isExit(false)
+{
+}
+
+AssetLoader::~AssetLoader()
+{
+	Terminate();
+}
+
+void AssetLoader::Init()
+{
+	// 萔t@C̓ǂݍ
+	ReadCSV("data/constant/AssetLoader.csv");
+
+	// DxLib̔񓯊ǂݍ݂sXbh̐
+	SetASyncLoadThreadNum(GetConstantInt("ASYNC_THREAD_NUM"));
+
+	// CSVǂݍރXbh𗧂Ă
+	for (int i = 0; i < GetConstantInt("WORKER_NUM"); i++) {
+		_worker.emplace_back(&AssetLoader::WorkerLoop, this);
+	}
+}
+
+void AssetLoader::Terminate()
+{
+	{
+		std::lock_guard<std::mutex> lock(_jobMutex);
+		_isExit = true;
+	}
+	_jobCondition.notify_all();
+
+	for (auto& worker : _worker) {
+		if (worker.joinable()) {
+			worker.join();
+		}
+	}
+	_worker.clear();
+}
+
+std::shared_future<void> AssetLoader::Request(const std::string& manifest)
+{
+	std::ifstream file(manifest);
+
+	// eꎞIɕۑĂϐ
+	std::string line, type, path;
+
+	// sڂ̃wb_[XLbv
+	std::getline(file, line);
+
+	while (std::getline(file, line)) {
+		std::stringstream ss(line);
+
+		std::getline(ss, type, ',');	// AZbg̎
+		std::getline(ss, path, ',');	// t@CpX
+
+		Item item;
+		item.path = path;
+		item.requestTime = TraceRecorder::GetInstance().GetTime();
+
+		// ނƂɓǂݍ݂n߂
+		if (type == "GRAPH") {
+			item.type = AssetType::Graph;
+			item.handle = AtlasManager::GetInstance().Preload(path);
+		}
+		else if (type == "MODEL") {
+			item.type = AssetType::Model;
+			item.handle = ModelManager::GetInstance().Preload(path);
+		}
+		else if (type == "CSV") {
+			item.type = AssetType::Csv;
+			item.future = Submit([path]() { Constant::Preload(path); });
+		}
+		else if (type == "EFFECT") {
+			item.type = AssetType::Effect;
+		}
+		else {
+			continue;
+		}
+
+		_item.push_back(std::move(item));
+	}
+
+	// ǂݍ݂IƂɊfuturen
+	_promise.emplace_back();
+	std::shared_future<void> future = _promise.back().get_future().share();
+
+	// ǂݍނ̂Ȃ΂Ɋ
+	if (_item.empty()) {
+		_promise.back().set_value();
+		_promise.pop_back();
+	}
+
+	return future;
+}
+
+void AssetLoader::Update()
+{
+	if (_item.empty()) return;
+
+	// GtFNg1t[ɓǂݍސ߂Ă
+	int effectNum = GetConstantInt("EFFECT_LOAD_NUM");
+
+	_doneNum = 0;
+	for (auto& item : _item) {
+		if (!item.isDone) {
+			switch (item.type)
+			{
+			case AssetType::Graph:
+			case AssetType::Model:
+				// ǂݍݎsÃV[ɓnč폜ς݂̂̂ÎƂ
+				item.isDone = item.handle == -1 || CheckHandleASyncLoad(item.handle) != TRUE;
+
+				// 񓯊ǂݍ݂ɂԂL^(ɋCÂt[܂)
+				if (item.isDone) {
+					TraceRecorder::GetInstance().AddAsyncSpan(item.type == AssetType::Graph ? "PreloadGraph" : "PreloadModel",
+						"load", item.path, item.requestTime, TraceRecorder::GetInstance().GetTime());
+				}
+				break;
+			case AssetType::Csv:
+				item.isDone = item.future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+				break;
+			case AssetType::Effect:
+				if (effectNum > 0) {
+					EffectManager::GetInstance().Preload(item.path);
+					effectNum--;
+					item.isDone = true;
+				}
+				break;
+			default:
+				item.isDone = true;
+				break;
+			}
+		}
+
+		if (item.isDone) _doneNum++;
+	}
+
+	// ׂďI҂Ăfuture
+	if (IsComplete()) {
+		for (auto& promise : _promise) {
+			promise.set_value();
+		}
+		_promise.clear();
+		_item.clear();
+		_doneNum = 0;
+	}
+}
+
+float AssetLoader::GetProgress() const
+{
+	if (_item.empty()) return 1.0f;
+
+	return static_cast<float>(_doneNum) / _item.size();
+}
+
+bool AssetLoader::IsComplete() const
+{
+	return _doneNum >= static_cast<int>(_item.size());
+}
+
+std::future<void> AssetLoader::Submit(std::function<void()> job)
+{
+	std::packaged_task<void()> task(std::move(job));
+	std::future<void> future = task.get_future();
+
+	// XbhȂ΂̏ōs
+	if (_worker.empty()) {
+		task();
+		return future;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(_jobMutex);
+		_job.push_back(std::move(task));
+	}
+	_jobCondition.notify_one();
+
+	return future;
+}
+
+void AssetLoader::WorkerLoop()
+{
+	while (true) {
+		std::packaged_task<void()> task;
+		{
+			std::unique_lock<std::mutex> lock(_jobMutex);
+			_jobCondition.wait(lock, [this]() { return _isExit || !_job.empty(); });
+
+			if (_isExit && _job.empty()) return;
+
+			task = std::move(_job.front());
+			_job.pop_front();
+		}
+
+		task();
+	}
+}
@@ -0,0 +1,161 @@
+#include "AtlasManager.h"
+#include "DxLib.h"
+#include "TraceRecorder.h"
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+AtlasManager::AtlasManager()
+{
+	// CfbNX̓ǂݍ(c[ōĂȂ΋̂܂)
+	ReadIndex("data/atlas/AtlasIndex.csv");
+}
+
+int AtlasManager::LoadGraph(const std::string& path)
+{
+	TraceScope trace("LoadGraph", "load", path);
+
+	// AgXɓĂȂ΃t@Cǂݍ
+	auto it = _index.find(path);
+	if (it == _index.end()) {
+
+		// ǂ݂Ă΂̃nhn
+		auto preload = _preload.find(path);
+		if (preload != _preload.end()) {
+			int handle = preload->second;
+			_preload.erase(preload);
+			return handle;
+		}
+
+		return DxLib::LoadGraph(path.c_str());
+	}
+
+	auto& entry = it->second;
+
+	// y[W͏߂ĎgƂɈxǂݍ
+	auto page = _pageHandle.find(entry.page);
+	if (page == _pageHandle.end()) {
+		page = _pageHandle.emplace(entry.page, DxLib::LoadGraph(entry.page.c_str())).first;
+	}
+
+	// y[Wǂ߂ȂΌ摜ǂݍ
+	if (page->second == -1) {
+		return DxLib::LoadGraph(path.c_str());
+	}
+
+	// y[W͈͂؂o
+	int handle = DerivationGraph(entry.x, entry.y, entry.width, entry.height, page->second);
+
+	_region[handle] = AtlasRegion{ page->second, entry.x, entry.y, entry.width, entry.height };
+
+	return handle;
+}
+
+int AtlasManager::Preload(const std::string& path)
+{
+	// AgXɓĂ΃y[Wɓǂݍł
+	auto it = _index.find(path);
+	if (it != _index.end()) {
+		auto page = _pageHandle.find(it->second.page);
+		if (page != _pageHandle.end()) return page->second;
+
+		SetUseASyncLoadFlag(TRUE);
+		int handle = DxLib::LoadGraph(it->second.page.c_str());
+		SetUseASyncLoadFlag(FALSE);
+
+		_pageHandle.emplace(it->second.page, handle);
+		return handle;
+	}
+
+	// 摜dɐǂ݂Ȃ
+	auto preload = _preload.find(path);
+	if (preload != _preload.end()) return preload->second;
+
+	SetUseASyncLoadFlag(TRUE);
+	int handle = DxLib::LoadGraph(path.c_str());
+	SetUseASyncLoadFlag(FALSE);
+
+	_preload.emplace(path, handle);
+	return handle;
+}
+
+void AtlasManager::DeleteUnusedPreload()
+{
+	for (auto& preload : _preload) {
+		DxLib::DeleteGraph(preload.second);
+	}
+	_preload.clear();
+}
+
+bool AtlasManager::GetRegion(int handle, AtlasRegion& region) const
+{
+	auto it = _region.find(handle);
+	if (it == _region.end()) return false;
+
+	// 폜ς݂̃nhʂ̉摜Ɏg񂳂ĂȂTCYŊmF
+	int width = 0;
+	int height = 0;
+	if (GetGraphSize(handle, &width, &height) == -1) return false;
+	if (width != it->second.width || height != it->second.height) return false;
+
+	region = it->second;
+	return true;
+}
+
+void AtlasManager::DeleteGraph(int handle)
+{
+	// 폜ԍʂ̉摜Ɏg񂳂Ă͈͂Ȃ悤AɖY
+	_region.erase(handle);
+
+	DxLib::DeleteGraph(handle);
+}
+
+void AtlasManager::DeletePage()
+{
+	for (auto& page : _pageHandle) {
+		DxLib::DeleteGraph(page.second);
+	}
+	_pageHandle.clear();
+	_region.clear();
+
+	DeleteUnusedPreload();
+}
+
+void AtlasManager::ReadIndex(const std::string& filename)
+{
+	std::ifstream file(filename);
+	if (!file.is_open()) return;
+
+	// eꎞIɕۑĂϐ
+	std::string line, path, page, x, y, width, height;
+
+	// sڂ̃wb_[XLbv
+	std::getline(file, line);
+
+	while (std::getline(file, line)) {
+		// GfB^sȂǂ̋̍s͔΂
+		if (!line.empty() && line.back() == '\r') line.pop_back();
+		if (line.empty()) continue;
+
+		std::stringstream ss(line);
+
+		std::getline(ss, path, ',');	// 摜̃pX
+		std::getline(ss, page, ',');	// y[W摜̃pX
+		std::getline(ss, x, ',');		// XW
+		std::getline(ss, y, ',');		// YW
+		std::getline(ss, width, ',');	// 
+		std::getline(ss, height, ',');	// 
+
+		// ǂ߂Ȃs͔΂(N~߂Ȃ)
+		try {
+			IndexEntry entry{ page, std::stoi(x), std::stoi(y), std::stoi(width), std::stoi(height) };
+			if (path.empty() || page.empty() || entry.x < 0 || entry.y < 0 || entry.width <= 0 || entry.height <= 0) {
+				throw std::invalid_argument(line);
+			}
+			_index[path] = entry;
+		}
+		catch (const std::exception&) {
+			LogFileFmtAdd("AtlasManager: %s ̍sǂ߂܂ł(%s)", filename.c_str(), line.c_str());
+		}
+	}
+}
@@ -25,7 +25,7 @@ BombBullet::BombBullet(Vec3 dist, Vec3 pos, std::shared_ptr<MapBulletCollisionMa
 	_distVec = dist;
 
 	// GtFNgCX^X̍쐬
-	_pEffect = std::make_shared<MyEffect>(BOMB_BULLET_EFFECT, pos);
+	_effect = MyEffect(BOMB_BULLET_EFFECT, pos);
 
 	// a̐ݒ
 	_radius = _bulletManager.GetConstantFloat("RADIUS");
@@ -34,10 +34,10 @@ BombBullet::BombBullet(Vec3 dist, Vec3 pos, std::shared_ptr<MapBulletCollisionMa
 BombBullet::~BombBullet()
 {
 	if (_frame == 0) {
-		_pEffect->StopEffect();
+		_effect.StopEffect();
 	}
 	else if (!_deadFlag) {
-		_explosionEffect->StopEffect();
+		_explosionEffect.StopEffect();
 	}
 }
 
@@ -56,27 +56,27 @@ void BombBullet::Update()
 	}
 
 	if (_frame > 0) {
-		_explosionEffect->Update(Position);
+		_explosionEffect.Update(Position);
 		_frame++;
 		if (_frame == Application::GetInstance().GetConstantInt("FRAME_NUM")) {
 			_deadFlag = true;
-			_explosionEffect->StopEffect();
+			_explosionEffect.StopEffect();
 		}
 	}
 	else {
 		// }bvƂ̓蔻Ƃ
 		if (_collManager->CollisionBullet(Position, _radius, BOMB_BULLET)) {
 
-			SoundManager::GetInstance().RingSE(SE_EXPLOSION);
+			SoundManager::GetInstance().RingSE(SE_EXPLOSION, Position);
 
-			_pEffect->StopEffect();
-			_explosionEffect = std::make_shared<MyEffect>(BLOCK_DESTROY_EFFECT, Position);
+			_effect.StopEffect();
+			_explosionEffect = MyEffect(BLOCK_DESTROY_EFFECT, Position);
 			_frame = 1;
 		}
 	}
 
 	// GtFNg̍XV
-	_pEffect->Update(Position);
+	_effect.Update(Position);
 }
 
 void BombBullet::Draw() const
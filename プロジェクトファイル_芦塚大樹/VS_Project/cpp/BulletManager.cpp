@@ -4,6 +4,7 @@
 #include "MapBulletCollisionManager.h"
 #include "GrapplerBullet.h"
 #include "BombBullet.h"
+#include "LatencyTracker.h"
 
 BulletManager::BulletManager(std::shared_ptr<MapBulletCollisionManager>& col, std::shared_ptr<WedgewormManager>& worm) :
 	_collManager(col),
@@ -44,6 +45,9 @@ void BulletManager::Draw() const
 
 void BulletManager::PushBullet(int bul, Vec3 dist, Vec3 pos, int plnum)
 {
+	// ͂̒x̌v
+	LatencyTracker::GetInstance().Mark(LatencyStage::Spawn);
+
 	switch (bul)
 	{
 	case NORMAL_BULLET:
@@ -120,3 +124,7 @@ std::list<std::shared_ptr<BulletBase>>& BulletManager::GetBulletList()
 	return _pBullet;
 }
 
+void BulletManager::Clear()
+{
+	_pBullet.clear();
+}
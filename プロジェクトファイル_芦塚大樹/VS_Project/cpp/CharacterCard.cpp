@@ -2,6 +2,7 @@
 #include "DxLib.h"
 #include "SceneSelect.h"
 #include "PlayerManager.h"
+#include "AtlasManager.h"
 
 CharacterCard::CharacterCard(int charNum) :
 	_cardHandle(0),
@@ -14,19 +15,19 @@ CharacterCard::CharacterCard(int charNum) :
 	switch (charNum)
 	{
 	case 0:
-		_cardHandle = LoadGraph("data/image/Card1.png");
+		_cardHandle = AtlasManager::GetInstance().LoadGraph("data/image/Card1.png");
 		_pos = Vec2{ GetConstantInt("CARD1_POS_X"),GetConstantInt("CARD1_POS_Y") };
 		break;
 	case 1:
-		_cardHandle = LoadGraph("data/image/Card2.png");
+		_cardHandle = AtlasManager::GetInstance().LoadGraph("data/image/Card2.png");
 		_pos = Vec2{ GetConstantInt("CARD2_POS_X"),GetConstantInt("CARD2_POS_Y") };
 		break;
 	case 2:
-		_cardHandle = LoadGraph("data/image/Card3.png");
+		_cardHandle = AtlasManager::GetInstance().LoadGraph("data/image/Card3.png");
 		_pos = Vec2{ GetConstantInt("CARD3_POS_X"),GetConstantInt("CARD3_POS_Y") };
 		break;
 	case 3:
-		_cardHandle = LoadGraph("data/image/Card4.png");
+		_cardHandle = AtlasManager::GetInstance().LoadGraph("data/image/Card4.png");
 		_pos = Vec2{ GetConstantInt("CARD4_POS_X"),GetConstantInt("CARD4_POS_Y") };
 		break;
 	default:
@@ -35,10 +36,10 @@ CharacterCard::CharacterCard(int charNum) :
 
 	// I摜̃[h
 	{
-		_cardSelectHandle[PLAYER_ONE] = LoadGraph("data/image/CardSelectedRed.png");
-		_cardSelectHandle[PLAYER_TWO] = LoadGraph("data/image/CardSelectedBlue.png");
-		_cardSelectHandle[PLAYER_THREE] = LoadGraph("data/image/CardSelectedGreen.png");
-		_cardSelectHandle[PLAYER_FORE] = LoadGraph("data/image/CardSelectedYellow.png");
+		_cardSelectHandle[PLAYER_ONE] = AtlasManager::GetInstance().LoadGraph("data/image/CardSelectedRed.png");
+		_cardSelectHandle[PLAYER_TWO] = AtlasManager::GetInstance().LoadGraph("data/image/CardSelectedBlue.png");
+		_cardSelectHandle[PLAYER_THREE] = AtlasManager::GetInstance().LoadGraph("data/image/CardSelectedGreen.png");
+		_cardSelectHandle[PLAYER_FORE] = AtlasManager::GetInstance().LoadGraph("data/image/CardSelectedYellow.png");
 	}
 
 	// ItȌ
@@ -50,9 +51,9 @@ CharacterCard::CharacterCard(int charNum) :
 CharacterCard::~CharacterCard()
 {
 	// 摜̃f[g
-	DeleteGraph(_cardHandle);
+	AtlasManager::GetInstance().DeleteGraph(_cardHandle);
 	for (auto& handle : _cardSelectHandle) {
-		DeleteGraph(handle);
+		AtlasManager::GetInstance().DeleteGraph(handle);
 	}
 }
 
@@ -3,6 +3,7 @@
 #include "CharacterCard.h"
 #include "Input.h"
 #include "SoundManager.h"
+#include "AtlasManager.h"
 
 CharacterSelectManager::CharacterSelectManager(PlayerData& plData) :
 	_plData(plData),
@@ -26,13 +27,13 @@ CharacterSelectManager::CharacterSelectManager(PlayerData& plData) :
 	}
 
 	// X^[g摜̃[h
-	_startButtonHandle = LoadGraph("data/image/ReadyFight.png");
+	_startButtonHandle = AtlasManager::GetInstance().LoadGraph("data/image/ReadyFight.png");
 	_startButtonPos = Vec2{ GetConstantFloat("START_BUTTON_POS_X"),GetConstantFloat("START_BUTTON_POS_Y") };
 }
 
 CharacterSelectManager::~CharacterSelectManager()
 {
-	DeleteGraph(_startButtonHandle);
+	AtlasManager::GetInstance().DeleteGraph(_startButtonHandle);
 }
 
 void CharacterSelectManager::Update()
@@ -2,6 +2,7 @@
 #include "Player.h"
 #include "StageManager.h"
 #include "Components.h"
+#include <cfloat>
 
 CollisionManager::CollisionManager(std::shared_ptr <StageManager>& stage) :
 	_pStage(stage)
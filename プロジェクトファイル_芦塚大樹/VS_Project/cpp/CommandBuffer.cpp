@@ -0,0 +1,35 @@
+#include "CommandBuffer.h"
+
+CommandBuffer::CommandBuffer() :
+	_isDeferred(false)
+{
+}
+
+CommandBuffer::~CommandBuffer()
+{
+}
+
+void CommandBuffer::Begin()
+{
+	_isDeferred = true;
+}
+
+void CommandBuffer::Push(std::function<void()> command)
+{
+	if (_isDeferred) {
+		_command.push_back(std::move(command));
+	}
+	else {
+		command();
+	}
+}
+
+void CommandBuffer::Execute()
+{
+	_isDeferred = false;
+
+	for (auto& command : _command) {
+		command();
+	}
+	_command.clear();
+}
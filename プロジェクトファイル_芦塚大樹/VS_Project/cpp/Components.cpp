@@ -2,6 +2,8 @@
 #include "DxLib.h"
 #include <cmath>
 #include <algorithm>
+#include "ModelManager.h"
+#include "FixedTimestep.h"
 
 // gXtH[
 
@@ -28,7 +30,7 @@ Model::Model() :
 
 Model::~Model()
 {
-	MV1DeleteModel(_modelHandle);
+	ModelManager::GetInstance().Release(_modelHandle);
 	DeleteGraph(m_textureHandle);
 }
 
@@ -47,6 +49,49 @@ void Model::InitModel(int modelHandle)
 }
 
 void Model::UpdateModel(Transform& transform)
+{
+	// eBbN̍ŏ̍XVŁAÕeBbÑgXtH[c
+	// (߂Ă̍XVł͑OȂ̂œ̂ɂ)
+	int tick = FixedTimestep::GetInstance().GetTick();
+	if (_updateTick != tick) {
+		_prevTransform = _updateTick == -1 ? transform : _currTransform;
+		_updateTick = tick;
+	}
+	_currTransform = transform;
+
+	ApplyMatrix(transform);
+}
+
+void Model::DrawModel() const
+{
+	auto& timestep = FixedTimestep::GetInstance();
+
+	// ̃eBbNœĂȂ΂̂܂ܕ`悷
+	if (_updateTick != timestep.GetTick() || timestep.GetAlpha() >= 1.0f) {
+		MV1DrawModel(_modelHandle);
+		return;
+	}
+
+	// ԂgXtH[ŕ`悷
+	Transform transform;
+	transform.Position = timestep.Interpolate(_prevTransform.Position, _currTransform.Position);
+	transform.Scale = timestep.Interpolate(_prevTransform.Scale, _currTransform.Scale);
+	transform.Angle.y = timestep.InterpolateAngle(_prevTransform.Angle.y, _currTransform.Angle.y);
+	ApplyMatrix(transform);
+
+	// f̕`
+	MV1DrawModel(_modelHandle);
+
+	// XVōsgƂ̂ŁÃeBbN̍sɖ߂
+	ApplyMatrix(_currTransform);
+}
+
+void Model::ResetModel()
+{
+	_updateTick = -1;
+}
+
+void Model::ApplyMatrix(const Transform& transform) const
 {
 	// ωs
 	MATRIX modelMtx;
@@ -70,12 +115,6 @@ void Model::UpdateModel(Transform& transform)
 	MV1SetMatrix(_modelHandle, modelMtx);
 }
 
-void Model::DrawModel() const
-{
-	// f̕`
-	MV1DrawModel(_modelHandle);
-}
-
 int Model::GetModelHandle() const
 {
 	return _modelHandle;
@@ -282,6 +321,19 @@ int Animation::GetAnimeFlame()
 	return static_cast<int>(_flameCount);
 }
 
+void Animation::ResetAnimation(int& modelHandle)
+{
+	// A^b`ĂAj[VO
+	MV1DetachAnim(modelHandle, _attachIndex1);
+	MV1DetachAnim(modelHandle, _attachIndex2);
+
+	// ̑ȌԂɖ߂ĂAftHg̃Aj[Vŏ
+	int tag = _defaultTag;
+	float rate = _defaultRate;
+	*this = Animation();
+	InitAnimation(modelHandle, tag, rate);
+}
+
 // JvZ
 
 CapsuleCollision::CapsuleCollision()
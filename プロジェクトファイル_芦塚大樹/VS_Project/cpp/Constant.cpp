@@ -1,8 +1,12 @@
 #include "Constant.h"
+#include "TraceRecorder.h"
 #include <fstream>
 #include <sstream>
 #include <cassert>
 
+std::map<std::string, std::map<std::string, Constant::ConstantVariant>> Constant::_csvCache;
+std::mutex Constant::_csvCacheMutex;
+
 std::map<std::string, Constant::ConstantVariant> Constant::GetConstants()
 {
 	return Constants;
@@ -53,8 +57,49 @@ bool Constant::GetConstatBool(std::string name) const
 	}
 }
 
+void Constant::Preload(const std::string& filename)
+{
+	{
+		std::lock_guard<std::mutex> lock(_csvCacheMutex);
+		if (_csvCache.find(filename) != _csvCache.end()) return;
+	}
+
+	// ǂݍ݂̓bN̊Oōs
+	auto constants = ParseCSV(filename);
+
+	std::lock_guard<std::mutex> lock(_csvCacheMutex);
+	_csvCache.emplace(filename, std::move(constants));
+}
+
 void Constant::ReadCSV(const std::string& filename)
 {
+	// ǂݍݍς݂CSVȂt@CJɎg
+	{
+		std::lock_guard<std::mutex> lock(_csvCacheMutex);
+		auto it = _csvCache.find(filename);
+		if (it != _csvCache.end()) {
+			for (auto& [name, value] : it->second) {
+				Constants[name] = value;
+			}
+			return;
+		}
+	}
+
+	auto constants = ParseCSV(filename);
+	for (auto& [name, value] : constants) {
+		Constants[name] = value;
+	}
+
+	std::lock_guard<std::mutex> lock(_csvCacheMutex);
+	_csvCache.emplace(filename, std::move(constants));
+}
+
+std::map<std::string, Constant::ConstantVariant> Constant::ParseCSV(const std::string& filename)
+{
+	TraceScope trace("ParseCSV", "load", filename);
+
+	std::map<std::string, ConstantVariant> constants;
+
 	// t@Cǂݍ
 	std::ifstream file(filename);
 
@@ -83,23 +128,23 @@ void Constant::ReadCSV(const std::string& filename)
 			switch (GetDataType(type)) {
 			case _INT: {
 				int intValue = std::stoi(value);
-				Constants[name] = intValue;
+				constants[name] = intValue;
 				break;
 			}
 			case _FLOAT: {
 				float floatValue = std::stof(value);
-				Constants[name] = floatValue;
+				constants[name] = floatValue;
 				break;
 			}
 			case _BOOL: {
 				std::stringstream boolStream(value);
 				bool boolValue;
 				boolStream >> std::boolalpha >> boolValue;
-				Constants[name] = boolValue;
+				constants[name] = boolValue;
 				break;
 			}
 			case _STRING: {
-				Constants[name] = value;
+				constants[name] = value;
 				break;
 			}
 			}
@@ -150,6 +195,8 @@ void Constant::ReadCSV(const std::string& filename)
 		}
 	}
 	file.close();
+
+	return constants;
 }
 
 DataType Constant::GetDataType(const std::string& type)
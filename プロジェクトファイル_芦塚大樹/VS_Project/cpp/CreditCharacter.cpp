@@ -1,5 +1,6 @@
 #include "CreditCharacter.h"
 #include "DxLib.h"
+#include "ModelManager.h"
 
 CreditCharacter::CreditCharacter(int num) :
 	_num(num)
@@ -19,25 +20,25 @@ CreditCharacter::CreditCharacter(int num) :
 	switch (num)
 	{
 	case 0:
-		InitModel(MV1LoadModel("data/model/DancePlayer1.mv1"));
+		InitModel(ModelManager::GetInstance().Duplicate("data/model/DancePlayer1.mv1"));
 
 		// W̐ݒ
 		Position = Vec3{ GetConstantFloat("CHARACTOR_POS_X"), GetConstantFloat("CHARACTOR_POS_Y"), GetConstantFloat("CHARACTOR_POS_Z") };
 		break;
 	case 1:
-		InitModel(MV1LoadModel("data/model/DancePlayer2.mv1"));
+		InitModel(ModelManager::GetInstance().Duplicate("data/model/DancePlayer2.mv1"));
 
 		// W̐ݒ
 		Position = Vec3{ GetConstantFloat("CHARACTOR_POS_X"), GetConstantFloat("CHARACTOR_POS_Y"),  -GetConstantFloat("CHARACTOR_POS_Z") };
 		break;
 	case 2:
-		InitModel(MV1LoadModel("data/model/DancePlayer3.mv1"));
+		InitModel(ModelManager::GetInstance().Duplicate("data/model/DancePlayer3.mv1"));
 
 		// W̐ݒ
 		Position = Vec3{ GetConstantFloat("CHARACTOR_POS_X"), GetConstantFloat("CHARACTOR_POS_Y"), GetConstantFloat("CHARACTOR_POS_Z") };
 		break;
 	case 3:
-		InitModel(MV1LoadModel("data/model/DancePlayer4.mv1"));
+		InitModel(ModelManager::GetInstance().Duplicate("data/model/DancePlayer4.mv1"));
 
 		// W̐ݒ
 		Position = Vec3{ GetConstantFloat("CHARACTOR_POS_X"), GetConstantFloat("CHARACTOR_POS_Y"), -GetConstantFloat("CHARACTOR_POS_Z") };
@@ -2,6 +2,7 @@
 #include "DxLib.h"
 #include "SceneTitle.h"
 #include "Application.h"
+#include "AtlasManager.h"
 
 Crown::Crown(SceneTitle& scene) :
 	_flame1(0),
@@ -17,10 +18,10 @@ Crown::Crown(SceneTitle& scene) :
 
 	// 摜̃[h
 	{
-		_crownHandle = LoadGraph("data/image/Crown.png");	// 摜̃[h
-		_crownParticleHandle1 = LoadGraph("data/image/CrownParticle1.png");	// p[eBN1摜̃[h
-		_crownParticleHandle2 = LoadGraph("data/image/CrownParticle2.png");	// p[eBN2摜̃[h
-		_crownParticleHandle3 = LoadGraph("data/image/CrownParticle3.png");	// p[eBN3摜̃[h
+		_crownHandle = AtlasManager::GetInstance().LoadGraph("data/image/Crown.png");	// 摜̃[h
+		_crownParticleHandle1 = AtlasManager::GetInstance().LoadGraph("data/image/CrownParticle1.png");	// p[eBN1摜̃[h
+		_crownParticleHandle2 = AtlasManager::GetInstance().LoadGraph("data/image/CrownParticle2.png");	// p[eBN2摜̃[h
+		_crownParticleHandle3 = AtlasManager::GetInstance().LoadGraph("data/image/CrownParticle3.png");	// p[eBN3摜̃[h
 	}
 
 	// \p[eBN̏ݒ
@@ -29,10 +30,10 @@ Crown::Crown(SceneTitle& scene) :
 
 Crown::~Crown()
 {
-	DeleteGraph(_crownHandle);
-	DeleteGraph(_crownParticleHandle1);
-	DeleteGraph(_crownParticleHandle2);
-	DeleteGraph(_crownParticleHandle3);
+	AtlasManager::GetInstance().DeleteGraph(_crownHandle);
+	AtlasManager::GetInstance().DeleteGraph(_crownParticleHandle1);
+	AtlasManager::GetInstance().DeleteGraph(_crownParticleHandle2);
+	AtlasManager::GetInstance().DeleteGraph(_crownParticleHandle3);
 }
 
 void Crown::Update()
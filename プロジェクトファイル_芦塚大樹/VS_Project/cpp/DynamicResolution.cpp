@@ -0,0 +1,77 @@
+#include "DynamicResolution.h"
+#include <algorithm>
+
+DynamicResolution::DynamicResolution() :
+	_gpuTimeSum(0),
+	_sampleCount(0),
+	_isChanged(false)
+{
+	// 萔t@C̓ǂݍ
+	ReadCSV("data/constant/DynamicResolution.csv");
+
+	// ŏ͍ő̔{n߂
+	_scale = GetConstantFloat("SCALE_MAX");
+}
+
+DynamicResolution::~DynamicResolution()
+{
+}
+
+void DynamicResolution::Update(long long gpuTime)
+{
+	_isChanged = false;
+
+	// t[̕ςŔf
+	_gpuTimeSum += gpuTime;
+	_sampleCount++;
+	if (_sampleCount < GetConstantInt("SAMPLE_FRAME")) return;
+
+	float average = static_cast<float>(_gpuTimeSum) / _sampleCount;
+	float target = static_cast<float>(GetConstantInt("TARGET_FRAME_TIME"));
+
+	_gpuTimeSum = 0;
+	_sampleCount = 0;
+
+	float scale = _scale;
+
+	// dΉ𑜓xA]TΏグ
+	if (average > target * GetConstantFloat("DOWN_SCALE_RATE")) {
+		scale -= GetConstantFloat("SCALE_STEP");
+	}
+	else if (average < target * GetConstantFloat("UP_SCALE_RATE")) {
+		scale += GetConstantFloat("SCALE_STEP");
+	}
+
+	// ݒ肳ꂽ͈͂Ɏ߂
+	scale = std::clamp(scale, GetConstantFloat("SCALE_MIN"), GetConstantFloat("SCALE_MAX"));
+
+	if (scale != _scale) {
+		_scale = scale;
+		_isChanged = true;
+	}
+}
+
+void DynamicResolution::Reset()
+{
+	_gpuTimeSum = 0;
+	_sampleCount = 0;
+
+	float scale = GetConstantFloat("SCALE_MAX");
+	_isChanged = scale != _scale;
+	_scale = scale;
+}
+
+float DynamicResolution::GetScale() const
+{
+	return _scale;
+}
+
+bool DynamicResolution::IsChanged() const
+{
+	return _isChanged;
+}
+
+int DynamicResolution::ScaleSize(int size) const
+{
+	return (std::max)(1, static_cast<int>(size * _scale));
+}
@@ -1,6 +1,35 @@
 #include "EffectManager.h"
 #include "DxLib.h"
 #include "EffekseerForDXLib.h"
+#include "TraceRecorder.h"
+#include "FixedTimestep.h"
+#include <algorithm>
+
+// GtFNg̃L[Ƃ̃t@CƁA傫EɍĐł鐔E1̃p[eBN̒萔
+struct EffectSource {
+	const char* path;
+	const char* sizeName;
+	const char* capName;
+	const char* particleName;
+};
+
+constexpr EffectSource EFFECT_SOURCE[MAX_EFFECT_NUM] = {
+	{ "data/effect/NormalBullet.efk", "NORMAL_BULLET_SIZE", "NORMAL_BULLET_CAP", "NORMAL_BULLET_PARTICLE" },	// NORMAL_BULLET_EFFECT
+	{ "data/effect/BombBullet.efk", "BOMB_BULLET_SIZE", "BOMB_BULLET_CAP", "BOMB_BULLET_PARTICLE" },			// BOMB_BULLET_EFFECT
+	{ "data/effect/GrappleBullet2.efk", "GRAPPLE_BULLET_SIZE", "GRAPPLE_BULLET_CAP", "GRAPPLE_BULLET_PARTICLE" },	// GRAPPLE_BULLET_EFFECT
+	{ "data/effect/test.efk", "BLOCK_DESTROY_SIZE", "BLOCK_DESTROY_CAP", "BLOCK_DESTROY_PARTICLE" },			// BLOCK_DESTROY_EFFECT
+	{ "data/effect/test.efk", "JUMP_SIZE", "JUMP_CAP", "JUMP_PARTICLE" },									// JUMP_EFFECT
+	{ "data/effect/Winner.efk", "WIN_SIZE", "WIN_CAP", "WIN_PARTICLE" },									// WIN_EFFECT
+	{ "data/effect/gekitui.efk", "SHOT_DOWN_SIZE", "SHOT_DOWN_CAP", "SHOT_DOWN_PARTICLE" },					// SHOT_DOWN_EFFECT
+	{ "data/effect/SpeedUp.efk", "SPEED_UP_SIZE", "SPEED_UP_CAP", "SPEED_UP_PARTICLE" },					// SPEED_UP_EFFECT
+};
+
+// ĐĂGtFNg̔ԍ̃rbg̊蓖(g̔ԍ8bitA8bitAg񂵂)
+constexpr int EFFECT_SLOT_BIT = 8;
+constexpr int EFFECT_TYPE_BIT = 8;
+constexpr int EFFECT_SLOT_MASK = (1 << EFFECT_SLOT_BIT) - 1;
+constexpr int EFFECT_TYPE_MASK = (1 << EFFECT_TYPE_BIT) - 1;
+constexpr int EFFECT_GENERATION_MASK = (1 << (31 - EFFECT_SLOT_BIT - EFFECT_TYPE_BIT)) - 1;
 
 void EffectManager::Init()
 {
@@ -8,7 +37,10 @@ void EffectManager::Init()
 	ReadCSV("data/constant/EffectManager.csv");
 
 	// Effekseer
-	Effekseer_Init(GetConstantInt("MAX_PARTICLE"));
+	{
+		TraceScope trace("Effekseer_Init", "init");
+		Effekseer_Init(GetConstantInt("MAX_PARTICLE"));
+	}
 
 	// tXN[EChE̐؂ւŃ\[X̂hB
 	SetChangeScreenModeGraphicsSystemResetFlag(FALSE);
@@ -16,18 +48,50 @@ void EffectManager::Init()
 	for (int i = 0; i < MAX_EFFECT_NUM; i++) {
 		_effectMap[i] = -1;
 	}
+
+	// Đg̍쐬
+	CreateSlot();
 }
 
-void EffectManager::Draw() const
+void EffectManager::Update()
 {
 	// ӂ̍XV
+	// `̃t[[gōĐ̑ςȂ悤AeBbNƂɐi߂
 	UpdateEffekseer3D();
+}
 
+void EffectManager::Draw() const
+{
 	// J̓
 	Effekseer_Sync3DSetting();
 
+	// ̃eBbNœGtFNǵAԂWŕ`悷
+	auto& timestep = FixedTimestep::GetInstance();
+	bool isInterpolated = timestep.GetAlpha() < 1.0f;
+	if (isInterpolated) {
+		for (auto& slots : _slot) {
+			for (auto& slot : slots) {
+				if (slot.playHandle == -1 || slot.updateTick != timestep.GetTick()) continue;
+
+				Vec3 pos = timestep.Interpolate(slot.prevPos, slot.currPos);
+				SetPosPlayingEffekseer3DEffect(slot.playHandle, pos.x, pos.y, pos.z);
+			}
+		}
+	}
+
 	// GtFNg̕`
 	DrawEffekseer3D();
+
+	// ̃eBbN̍XVŎĝŁÃeBbN̍Wɖ߂
+	if (isInterpolated) {
+		for (auto& slots : _slot) {
+			for (auto& slot : slots) {
+				if (slot.playHandle == -1 || slot.updateTick != timestep.GetTick()) continue;
+
+				SetPosPlayingEffekseer3DEffect(slot.playHandle, slot.currPos.x, slot.currPos.y, slot.currPos.z);
+			}
+		}
+	}
 }
 
 void EffectManager::Terminate()
@@ -49,41 +113,162 @@ int& EffectManager::GetEffectHandle(int effect)
 
 void EffectManager::DeleteEffect()
 {
+	// Đ̂̂~߂Ęg󂯂
+	for (auto& slots : _slot) {
+		for (auto& slot : slots) {
+			if (slot.playHandle != -1) {
+				StopEffekseer3DEffect(slot.playHandle);
+				slot.playHandle = -1;
+				slot.generation++;
+			}
+		}
+	}
+
 	for (auto& [key, value] : _effectMap) {
 		DeleteEffekseerEffect(value);
 	}
 }
 
+int EffectManager::Preload(const std::string& path)
+{
+	// t@C傫ςĎgނ̂ŁAׂă[h
+	int handle = -1;
+	for (int i = 0; i < MAX_EFFECT_NUM; i++) {
+		if (path != EFFECT_SOURCE[i].path) continue;
+
+		// [hł΃[h
+		handle = GetEffectHandle(i);
+	}
+
+	return handle;
+}
+
 void EffectManager::LoadEffect(int effect)
 {
+	if (effect < 0 || effect >= MAX_EFFECT_NUM) return;
+
 	// ̃GtFNg[h
-	switch (effect)
-	{
-	case NORMAL_BULLET_EFFECT:
-		_effectMap[effect] = LoadEffekseerEffect("data/effect/NormalBullet.efk", GetConstantFloat("NORMAL_BULLET_SIZE"));
-		break;
-	case BOMB_BULLET_EFFECT:
-		_effectMap[effect] = LoadEffekseerEffect("data/effect/BombBullet.efk", GetConstantFloat("BOMB_BULLET_SIZE"));
-		break;
-	case GRAPPLE_BULLET_EFFECT:
-		_effectMap[effect] = LoadEffekseerEffect("data/effect/GrappleBullet2.efk", GetConstantFloat("GRAPPLE_BULLET_SIZE"));
-		break;
-	case BLOCK_DESTROY_EFFECT:
-		_effectMap[effect] = LoadEffekseerEffect("data/effects/test.efk", GetConstantFloat("BLOCK_DESTROY_SIZE"));
-		break;
-	case JUMP_EFFECT:
-		_effectMap[effect] = LoadEffekseerEffect("data/effect/test.efk", GetConstantFloat("JUMP_SIZE"));
-		break;
-	case WIN_EFFECT:
-		_effectMap[effect] = LoadEffekseerEffect("data/effect/Winner.efk", GetConstantFloat("WIN_SIZE"));
-		break;
-	case SHOT_DOWN_EFFECT:
-		_effectMap[effect] = LoadEffekseerEffect("data/effect/gekitui.efk", GetConstantFloat("SHOT_DOWN_SIZE"));
-		break;
-	case SPEED_UP_EFFECT:
-		_effectMap[effect] = LoadEffekseerEffect("data/effect/SpeedUp.efk", GetConstantFloat("SPEED_UP_SIZE"));
-		break;
-	default:
-		break;
+	TraceScope trace("LoadEffekseerEffect", "load", EFFECT_SOURCE[effect].path);
+	_effectMap[effect] = LoadEffekseerEffect(EFFECT_SOURCE[effect].path, GetConstantFloat(EFFECT_SOURCE[effect].sizeName));
+}
+
+int EffectManager::Play(int effect, const Vec3& pos)
+{
+	if (effect < 0 || effect >= MAX_EFFECT_NUM) return -1;
+
+	auto& slots = _slot[effect];
+	if (slots.empty()) return -1;
+
+	// 󂢂ĂgAĐIgT
+	int index = -1;
+	for (int i = 0; i < static_cast<int>(slots.size()); i++) {
+		if (slots[i].playHandle == -1 || IsEffekseer3DEffectPlaying(slots[i].playHandle) != 0) {
+			index = i;
+			break;
+		}
+	}
+
+	// ȂΈԌÂ̂~߂Ďg
+	if (index == -1) {
+		index = 0;
+		for (int i = 1; i < static_cast<int>(slots.size()); i++) {
+			if (slots[i].order < slots[index].order) index = i;
+		}
+		StopEffekseer3DEffect(slots[index].playHandle);
 	}
+
+	EffectSlot& slot = slots[index];
+	slot.playHandle = PlayEffekseer3DEffect(GetEffectHandle(effect));
+	slot.generation = (slot.generation + 1) & EFFECT_GENERATION_MASK;
+	slot.order = _playCount++;
+	slot.prevPos = pos;
+	slot.currPos = pos;
+	slot.updateTick = -1;
+	if (slot.playHandle == -1) return -1;
+
+	SetPosPlayingEffekseer3DEffect(slot.playHandle, pos.x, pos.y, pos.z);
+
+	return (slot.generation << (EFFECT_SLOT_BIT + EFFECT_TYPE_BIT)) | (effect << EFFECT_SLOT_BIT) | index;
+}
+
+void EffectManager::SetPos(int instance, const Vec3& pos)
+{
+	int playHandle = GetPlayHandle(instance);
+	if (playHandle == -1) return;
+
+	// eBbN̍ŏ̈ړŁAÕeBbN̍Wc
+	EffectSlot& slot = _slot[(instance >> EFFECT_SLOT_BIT) & EFFECT_TYPE_MASK][instance & EFFECT_SLOT_MASK];
+	int tick = FixedTimestep::GetInstance().GetTick();
+	if (slot.updateTick != tick) {
+		slot.prevPos = slot.currPos;
+		slot.updateTick = tick;
+	}
+	slot.currPos = pos;
+
+	SetPosPlayingEffekseer3DEffect(playHandle, pos.x, pos.y, pos.z);
+}
+
+void EffectManager::SetScale(int instance, const Vec3& scale)
+{
+	int playHandle = GetPlayHandle(instance);
+	if (playHandle == -1) return;
+
+	SetScalePlayingEffekseer3DEffect(playHandle, scale.x, scale.y, scale.z);
+}
+
+void EffectManager::Stop(int instance)
+{
+	int playHandle = GetPlayHandle(instance);
+	if (playHandle == -1) return;
+
+	StopEffekseer3DEffect(playHandle);
+
+	// g󂯂
+	EffectSlot& slot = _slot[(instance >> EFFECT_SLOT_BIT) & EFFECT_TYPE_MASK][instance & EFFECT_SLOT_MASK];
+	slot.playHandle = -1;
+}
+
+void EffectManager::CreateSlot()
+{
+	int cap[MAX_EFFECT_NUM];
+	int particle[MAX_EFFECT_NUM];
+	int total = 0;
+	for (int i = 0; i < MAX_EFFECT_NUM; i++) {
+		cap[i] = std::clamp(GetConstantInt(EFFECT_SOURCE[i].capName), 1, EFFECT_SLOT_MASK + 1);
+		particle[i] = GetConstantInt(EFFECT_SOURCE[i].particleName);
+		total += cap[i] * particle[i];
+	}
+
+	// p[eBŇς肪𒴂Ă΁Aԑgނ1炷
+	while (total > GetConstantInt("MAX_PARTICLE")) {
+		int most = -1;
+		for (int i = 0; i < MAX_EFFECT_NUM; i++) {
+			if (cap[i] <= 1) continue;
+			if (most == -1 || cap[i] * particle[i] > cap[most] * particle[most]) most = i;
+		}
+		if (most == -1) break;
+
+		cap[most]--;
+		total -= particle[most];
+	}
+
+	for (int i = 0; i < MAX_EFFECT_NUM; i++) {
+		_slot[i].assign(cap[i], EffectSlot());
+	}
+}
+
+int EffectManager::GetPlayHandle(int instance) const
+{
+	if (instance < 0) return -1;
+
+	int index = instance & EFFECT_SLOT_MASK;
+	int effect = (instance >> EFFECT_SLOT_BIT) & EFFECT_TYPE_MASK;
+	int generation = instance >> (EFFECT_SLOT_BIT + EFFECT_TYPE_BIT);
+	if (effect >= MAX_EFFECT_NUM || index >= static_cast<int>(_slot[effect].size())) return -1;
+
+	// gʂ̃GtFNgɎg񂳂ĂΐGȂ
+	const EffectSlot& slot = _slot[effect][index];
+	if (slot.generation != generation) return -1;
+
+	return slot.playHandle;
 }
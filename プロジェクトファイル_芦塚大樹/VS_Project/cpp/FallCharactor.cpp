@@ -1,8 +1,10 @@
 #include "FallCharactor.h"
 #include "DxLib.h"
 #include <ctime>
+#include <algorithm>
 #include "SoundManager.h"
 #include "Application.h"
+#include "AtlasManager.h"
 
 FallCharactor::FallCharactor() :
 	_fallFlame(0)
@@ -15,10 +17,10 @@ FallCharactor::FallCharactor() :
 
 	// L̉摜̃[h
 	{
-		_fallCharactorHandle[CHARACTER_1] = LoadGraph("data/image/Falling1.png");
-		_fallCharactorHandle[CHARACTER_2] = LoadGraph("data/image/Falling2.png");
-		_fallCharactorHandle[CHARACTER_3] = LoadGraph("data/image/Falling3.png");
-		_fallCharactorHandle[CHARACTER_4] = LoadGraph("data/image/Falling4.png");
+		_fallCharactorHandle[CHARACTER_1] = AtlasManager::GetInstance().LoadGraph("data/image/Falling1.png");
+		_fallCharactorHandle[CHARACTER_2] = AtlasManager::GetInstance().LoadGraph("data/image/Falling2.png");
+		_fallCharactorHandle[CHARACTER_3] = AtlasManager::GetInstance().LoadGraph("data/image/Falling3.png");
+		_fallCharactorHandle[CHARACTER_4] = AtlasManager::GetInstance().LoadGraph("data/image/Falling4.png");
 	}
 }
 
@@ -26,7 +28,7 @@ FallCharactor::~FallCharactor()
 {
 	// L̉摜̍폜
 	for (int i = 0; i < 4; i++) {
-		DeleteGraph(_fallCharactorHandle[i]);
+		AtlasManager::GetInstance().DeleteGraph(_fallCharactorHandle[i]);
 	}
 }
 
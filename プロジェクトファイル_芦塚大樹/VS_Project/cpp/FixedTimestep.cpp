@@ -0,0 +1,80 @@
+#include "FixedTimestep.h"
+#include "DxLib.h"
+#include <algorithm>
+
+FixedTimestep::FixedTimestep() :
+	_accumulator(0),
+	_tick(0),
+	_alpha(1.0f)
+{
+	// 萔t@C̓ǂݍ
+	ReadCSV("data/constant/FixedTimestep.csv");
+
+	_tickDuration = 1000000 / GetConstantInt("TICK_RATE");
+
+	// ŏ̃t[1eBbNiނ悤ɂ
+	_lastTime = GetNowHiPerformanceCount() - _tickDuration;
+}
+
+int FixedTimestep::Advance()
+{
+	long long now = GetNowHiPerformanceCount();
+	long long elapsed = now - _lastTime;
+	_lastTime = now;
+
+	// eBbN̐{(1{ȏ)ɋ߂΂낦
+	// (`ƃeBbNԊûƂɁA̗h02̃t[݂ɏoȂ悤ɂ)
+	long long remain = elapsed % _tickDuration;
+	long long snap = GetConstantInt("SNAP_TIME");
+	if (elapsed >= _tickDuration && remain < snap) {
+		elapsed -= remain;
+	}
+	else if (_tickDuration - remain < snap) {
+		elapsed += _tickDuration - remain;
+	}
+	_accumulator += elapsed;
+
+	// ǂݍ݂Ȃǂő傫~܂ƂɁAeBbNʂɐi߂ĂɒxȂ悤ɂ
+	_accumulator = (std::min)(_accumulator, _tickDuration * GetConstantInt("MAX_TICK_NUM"));
+
+	int tickNum = static_cast<int>(_accumulator / _tickDuration);
+	_accumulator -= _tickDuration * tickNum;
+
+	// ]Ԃ̊ŕԂ
+	_alpha = GetConstatBool("INTERPOLATE") ? static_cast<float>(_accumulator) / _tickDuration : 1.0f;
+
+	return tickNum;
+}
+
+void FixedTimestep::BeginTick()
+{
+	_tick++;
+}
+
+int FixedTimestep::GetTick() const
+{
+	return _tick;
+}
+
+long long FixedTimestep::GetTickDuration() const
+{
+	return _tickDuration;
+}
+
+float FixedTimestep::GetAlpha() const
+{
+	return _alpha;
+}
+
+Vec3 FixedTimestep::Interpolate(const Vec3& prev, const Vec3& curr) const
+{
+	return prev + (curr - prev) * _alpha;
+}
+
+float FixedTimestep::InterpolateAngle(float prev, float curr) const
+{
+	// -΁`΂Ɏ߂ċ߂ɉ
+	float diff = std::remainder(curr - prev, static_cast<float>(DX_TWO_PI));
+
+	return prev + diff * _alpha;
+}
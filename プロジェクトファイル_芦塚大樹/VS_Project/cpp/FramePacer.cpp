@@ -0,0 +1,94 @@
+#include "FramePacer.h"
+#include "DxLib.h"
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#ifdef _WIN32
+#include <timeapi.h>
+#pragma comment(lib, "winmm.lib")
+#endif
+
+FramePacer::FramePacer() :
+	_frameDuration(0),
+	_sampleIndex(0)
+{
+	// 萔t@C̓ǂݍ
+	ReadCSV("data/constant/FramePacer.csv");
+
+#ifdef _WIN32
+	// Sleep1msPʂŋN悤ɂ(Wł15.6msP)
+	timeBeginPeriod(1);
+#endif
+
+	_lastTime = GetNowHiPerformanceCount();
+	SetTargetFps(GetConstantInt("TARGET_FPS"));
+}
+
+FramePacer::~FramePacer()
+{
+#ifdef _WIN32
+	timeEndPeriod(1);
+#endif
+}
+
+void FramePacer::SetTargetFps(int fps)
+{
+	_frameDuration = fps > 0 ? 1000000 / fps : 0;
+
+	// 琔
+	_nextTime = GetNowHiPerformanceCount();
+}
+
+void FramePacer::Wait()
+{
+	if (_frameDuration > 0) {
+		_nextTime += _frameDuration;
+
+		// 1t[ȏxĂ΁A߂Ƃ琔
+		long long now = GetNowHiPerformanceCount();
+		if (now - _nextTime > _frameDuration) {
+			_nextTime = now;
+		}
+
+		// ƋN̂x邱Ƃ̂ŁA\莞̏O܂ł͖
+		long long margin = GetConstantInt("SLEEP_MARGIN");
+		while (_nextTime - GetNowHiPerformanceCount() > margin) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+
+		// c͉񂵂đ҂
+		while (GetNowHiPerformanceCount() < _nextTime) {
+			std::this_thread::yield();
+		}
+	}
+
+	// t[̊ԊuL^
+	long long now = GetNowHiPerformanceCount();
+	long long interval = now - _lastTime;
+	_lastTime = now;
+
+	if (static_cast<int>(_sample.size()) < GetConstantInt("SAMPLE_FRAME")) {
+		_sample.push_back(interval);
+	}
+	else {
+		_sample[_sampleIndex] = interval;
+		_sampleIndex = (_sampleIndex + 1) % static_cast<int>(_sample.size());
+	}
+}
+
+long long FramePacer::GetPercentile(float rate) const
+{
+	if (_sample.empty()) return 0;
+
+	std::vector<long long> sorted = _sample;
+	int index = static_cast<int>(std::clamp(rate, 0.0f, 1.0f) * (sorted.size() - 1));
+	std::nth_element(sorted.begin(), sorted.begin() + index, sorted.end());
+
+	return sorted[index];
+}
+
+void FramePacer::Report() const
+{
+	LogFileFmtAdd("FramePacer: %d frames p50 %lld us, p95 %lld us, p99 %lld us",
+		static_cast<int>(_sample.size()), GetPercentile(0.5f), GetPercentile(0.95f), GetPercentile(0.99f));
+}
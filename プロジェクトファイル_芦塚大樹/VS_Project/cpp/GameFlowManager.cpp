@@ -49,3 +49,10 @@ int GameFlowManager::GetGameTime()
 {
 	return _gameTime;
 }
+
+void GameFlowManager::Reset()
+{
+	_gameEndFlag = false;
+	_frame = 0;
+	_gameTime = 0;
+}
@@ -0,0 +1,77 @@
+#include "GamepadDevice.h"
+#include "DxLib.h"
+
+GamepadDevice::GamepadDevice(int pad) :
+	_pad(pad),
+	_sample(),
+	_hasSample(false),
+	_isConnected(false)
+{
+}
+
+GamepadDevice::~GamepadDevice()
+{
+}
+
+void GamepadDevice::Update(long long)
+{
+	// Xbhœǂł΃L[o
+	if (InputSampler::GetInstance().IsRunning()) return;
+
+	_isConnected = _pad < GetJoypadNum();
+	if (!_isConnected) return;
+
+	// ݂̃Xe[g擾
+	XINPUT_STATE state = {};
+	GetJoypadXInputState(DX_INPUT_PAD1 + _pad, &state);
+
+	// {^rbgɒ
+	// (DxLib̃{^̓YXInput̃{^̃rbg̔ԍƓ)
+	_sample.time = InputSampler::GetTime();
+	_sample.buttons = 0;
+	for (int button = 0; button < 16; button++) {
+		if (state.Buttons[button]) _sample.buttons |= 1u << button;
+	}
+	if (state.LeftTrigger >= 1) _sample.buttons |= PAD_LEFT_TRIGGER_BIT;
+	if (state.RightTrigger >= 1) _sample.buttons |= PAD_RIGHT_TRIGGER_BIT;
+	_sample.leftTrigger = state.LeftTrigger;
+	_sample.rightTrigger = state.RightTrigger;
+	_sample.thumbLX = state.ThumbLX;
+	_sample.thumbLY = state.ThumbLY;
+	_sample.thumbRX = state.ThumbRX;
+	_sample.thumbRY = state.ThumbRY;
+	_hasSample = true;
+}
+
+bool GamepadDevice::Peek(long long tickTime, PadSample& sample)
+{
+	auto& sampler = InputSampler::GetInstance();
+	if (sampler.IsRunning()) {
+		return sampler.Peek(_pad, sample) && sample.time <= tickTime;
+	}
+
+	if (!_hasSample) return false;
+	sample = _sample;
+	return true;
+}
+
+void GamepadDevice::Pop()
+{
+	auto& sampler = InputSampler::GetInstance();
+	if (sampler.IsRunning()) {
+		sampler.Pop(_pad);
+		return;
+	}
+
+	_hasSample = false;
+}
+
+bool GamepadDevice::IsConnected() const
+{
+	auto& sampler = InputSampler::GetInstance();
+	if (sampler.IsRunning()) {
+		return sampler.IsConnected(_pad);
+	}
+
+	return _isConnected;
+}
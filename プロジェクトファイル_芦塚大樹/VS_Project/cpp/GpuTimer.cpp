@@ -0,0 +1,120 @@
+#include "GpuTimer.h"
+#include "DxLib.h"
+#ifdef _WIN32
+#include <d3d11.h>
+#endif
+
+// Ɏgt[̐(ʂ͂ӂ2`3t[xē͂)
+constexpr int GPU_TIMER_FRAME_NUM = 4;
+
+GpuTimer::GpuTimer() :
+	_frameIndex(0),
+	_isBegun(false),
+	_time(-1)
+{
+#ifdef _WIN32
+	auto device = static_cast<ID3D11Device*>(const_cast<void*>(GetUseDirect3D11Device()));
+	if (!device) return;
+
+	D3D11_QUERY_DESC disjointDesc = { D3D11_QUERY_TIMESTAMP_DISJOINT, 0 };
+	D3D11_QUERY_DESC timestampDesc = { D3D11_QUERY_TIMESTAMP, 0 };
+
+	_frame.resize(GPU_TIMER_FRAME_NUM);
+	for (auto& frame : _frame) {
+		if (FAILED(device->CreateQuery(&disjointDesc, &frame.disjoint)) ||
+			FAILED(device->CreateQuery(&timestampDesc, &frame.begin)) ||
+			FAILED(device->CreateQuery(&timestampDesc, &frame.end))) {
+
+			// ȂΑȂ
+			LogFileFmtAdd("GpuTimer: failed to create timestamp queries");
+			Release();
+			return;
+		}
+	}
+#endif
+}
+
+GpuTimer::~GpuTimer()
+{
+	Release();
+}
+
+void GpuTimer::Begin()
+{
+#ifdef _WIN32
+	if (_frame.empty()) return;
+
+	Collect();
+
+	// GPUxĂĎgNGȂ΁Ãt[͑Ȃ
+	auto& frame = _frame[_frameIndex];
+	if (frame.isPending) return;
+
+	auto context = static_cast<ID3D11DeviceContext*>(const_cast<void*>(GetUseDirect3D11DeviceContext()));
+	context->Begin(frame.disjoint);
+	context->End(frame.begin);
+	_isBegun = true;
+#endif
+}
+
+void GpuTimer::End()
+{
+#ifdef _WIN32
+	if (!_isBegun) return;
+
+	auto& frame = _frame[_frameIndex];
+
+	auto context = static_cast<ID3D11DeviceContext*>(const_cast<void*>(GetUseDirect3D11DeviceContext()));
+	context->End(frame.end);
+	context->End(frame.disjoint);
+
+	frame.isPending = true;
+	_frameIndex = (_frameIndex + 1) % GPU_TIMER_FRAME_NUM;
+	_isBegun = false;
+#endif
+}
+
+long long GpuTimer::GetTime() const
+{
+	return _time;
+}
+
+void GpuTimer::Collect()
+{
+#ifdef _WIN32
+	auto context = static_cast<ID3D11DeviceContext*>(const_cast<void*>(GetUseDirect3D11DeviceContext()));
+
+	// Â̂珇ɁA܂͂ĂȂ̂o܂œǂ
+	for (int i = 0; i < GPU_TIMER_FRAME_NUM; i++) {
+		auto& frame = _frame[(_frameIndex + i) % GPU_TIMER_FRAME_NUM];
+		if (!frame.isPending) continue;
+
+		D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjoint;
+		if (context->GetData(frame.disjoint, &disjoint, sizeof(disjoint), D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK) break;
+
+		UINT64 begin = 0;
+		UINT64 end = 0;
+		if (context->GetData(frame.begin, &begin, sizeof(begin), D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK ||
+			context->GetData(frame.end, &end, sizeof(end), D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK) break;
+
+		frame.isPending = false;
+
+		// vɃNbNςt[͎gȂ
+		if (disjoint.Disjoint || disjoint.Frequency == 0 || end < begin) continue;
+
+		_time = static_cast<long long>((end - begin) * 1000000 / disjoint.Frequency);
+	}
+#endif
+}
+
+void GpuTimer::Release()
+{
+#ifdef _WIN32
+	for (auto& frame : _frame) {
+		if (frame.disjoint) frame.disjoint->Release();
+		if (frame.begin) frame.begin->Release();
+		if (frame.end) frame.end->Release();
+	}
+#endif
+	_frame.clear();
+}
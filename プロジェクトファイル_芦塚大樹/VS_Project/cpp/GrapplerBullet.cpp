@@ -27,7 +27,7 @@ GrapplerBullet::GrapplerBullet(Vec3 dist, Vec3 pos, std::shared_ptr<MapBulletCol
 	_distVec = dist;
 
 	// GtFNgCX^X̍쐬
-	_pEffect = std::make_shared<MyEffect>(GRAPPLE_BULLET_EFFECT, pos);
+	_effect = MyEffect(GRAPPLE_BULLET_EFFECT, pos);
 
 	// a̐ݒ
 	_radius = _bulletManager.GetConstantFloat("RADIUS");
@@ -36,7 +36,7 @@ GrapplerBullet::GrapplerBullet(Vec3 dist, Vec3 pos, std::shared_ptr<MapBulletCol
 GrapplerBullet::~GrapplerBullet()
 {
 	if (!_deadFlag) {
-		_pEffect->StopEffect();
+		_effect.StopEffect();
 	}
 }
 
@@ -70,11 +70,11 @@ void GrapplerBullet::Update()
 
 	// GtFNg̍폜
 	if (_deadFlag) {
-		_pEffect->StopEffect();
+		_effect.StopEffect();
 	}
 
 	// GtFNg̍XV
-	_pEffect->Update(Position);
+	_effect.Update(Position);
 }
 
 void GrapplerBullet::Draw() const
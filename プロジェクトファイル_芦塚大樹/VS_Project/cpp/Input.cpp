@@ -1,209 +1,234 @@
 #include "Input.h"
+#include "GamepadDevice.h"
+#include "KeyboardDevice.h"
+#include "VirtualPadDevice.h"
+#include <bit>
 #include <cassert>
 
-void Input::Update()
-{
-	// ڑĂRg[[̐擾
-	_padNum = GetJoypadNum();
+// INPUT_A`INPUT_RIGHT_TRIGGER̃{^̃rbg
+// (DxLib̃{^̓YXInput̃{^̃rbg̔ԍƓ)
+constexpr unsigned int INPUT_BIT[INPUT_RIGHT_TRIGGER + 1] = {
+	1u << XINPUT_BUTTON_A,
+	1u << XINPUT_BUTTON_B,
+	1u << XINPUT_BUTTON_X,
+	1u << XINPUT_BUTTON_Y,
+	1u << XINPUT_BUTTON_DPAD_UP,
+	1u << XINPUT_BUTTON_DPAD_DOWN,
+	1u << XINPUT_BUTTON_DPAD_LEFT,
+	1u << XINPUT_BUTTON_DPAD_RIGHT,
+	1u << XINPUT_BUTTON_START,
+	1u << XINPUT_BUTTON_BACK,
+	1u << XINPUT_BUTTON_LEFT_THUMB,
+	1u << XINPUT_BUTTON_RIGHT_THUMB,
+	1u << XINPUT_BUTTON_LEFT_SHOULDER,
+	1u << XINPUT_BUTTON_RIGHT_SHOULDER,
+	PAD_LEFT_TRIGGER_BIT,
+	PAD_RIGHT_TRIGGER_BIT,
+};
 
-	int num = 0x0001;
+// {^16̃rbg
+constexpr unsigned int BUTTON_BIT_MASK = 0xffff;
 
-	// ȑÕXe[gۑ
-	for (int i = 0; i < _padNum; i++) {
+// pbh̔ԍƂ̓͑u̎ނ̒萔
+constexpr const char* DEVICE_CONSTANT_NAME[MAX_PAD_NUM] = {
+	"DEVICE_PAD_1",
+	"DEVICE_PAD_2",
+	"DEVICE_PAD_3",
+	"DEVICE_PAD_4",
+};
 
-		// ȑÕXe[gۑ
-		_lastPadState[i] = _padState[i];
+// z̃pbhōĐXNvg
+constexpr const char* INPUT_SCRIPT_PATH = "data/script/InputScript.csv";
 
-		// ݂̃Xe[g擾
-		GetJoypadXInputState(num, &_padState[i]);
+Input::Input()
+{
+}
 
-		num += 0x0001;
-	}
+Input::~Input()
+{
 }
 
-// u
-bool Input::IsTrigger(int input, int padNum) const
+void Input::Init()
 {
-	assert(padNum < _padNum);
+	// 萔t@C̓ǂݍ
+	ReadCSV("data/constant/Input.csv");
 
-	if (input == INPUT_A) {
-		return (!_lastPadState[padNum].Buttons[XINPUT_BUTTON_A] && _padState[padNum].Buttons[XINPUT_BUTTON_A]);
-	}
-	if (input == INPUT_B) {
-		return (!_lastPadState[padNum].Buttons[XINPUT_BUTTON_B] && _padState[padNum].Buttons[XINPUT_BUTTON_B]);
-	}
-	if (input == INPUT_X) {
-		return (!_lastPadState[padNum].Buttons[XINPUT_BUTTON_X] && _padState[padNum].Buttons[XINPUT_BUTTON_X]);
-	}
-	if (input == INPUT_Y) {
-		return (!_lastPadState[padNum].Buttons[XINPUT_BUTTON_Y] && _padState[padNum].Buttons[XINPUT_BUTTON_Y]);
-	}
-	if (input == INPUT_UP) {
-		return (!_lastPadState[padNum].Buttons[XINPUT_BUTTON_DPAD_UP] && _padState[padNum].Buttons[XINPUT_BUTTON_DPAD_UP]);
-	}
-	if (input == INPUT_DOWN) {
-		return (!_lastPadState[padNum].Buttons[XINPUT_BUTTON_DPAD_DOWN] && _padState[padNum].Buttons[XINPUT_BUTTON_DPAD_DOWN]);
-	}
-	if (input == INPUT_LEFT) {
-		return (!_lastPadState[padNum].Buttons[XINPUT_BUTTON_DPAD_LEFT] && _padState[padNum].Buttons[XINPUT_BUTTON_DPAD_LEFT]);
-	}
-	if (input == INPUT_RIGHT) {
-		return (!_lastPadState[padNum].Buttons[XINPUT_BUTTON_DPAD_RIGHT] && _padState[padNum].Buttons[XINPUT_BUTTON_DPAD_RIGHT]);
-	}
-	if (input == INPUT_START) {
-		return (!_lastPadState[padNum].Buttons[XINPUT_BUTTON_START] && _padState[padNum].Buttons[XINPUT_BUTTON_START]);
-	}
-	if (input == INPUT_BACK) {
-		return (!_lastPadState[padNum].Buttons[XINPUT_BUTTON_BACK] && _padState[padNum].Buttons[XINPUT_BUTTON_BACK]);
-	}
-	if (input == INPUT_LEFT_PUSH) {
-		return (!_lastPadState[padNum].Buttons[XINPUT_BUTTON_LEFT_THUMB] && _padState[padNum].Buttons[XINPUT_BUTTON_LEFT_THUMB]);
-	}
-	if (input == INPUT_RIGHT_PUSH) {
-		return (!_lastPadState[padNum].Buttons[XINPUT_BUTTON_RIGHT_THUMB] && _padState[padNum].Buttons[XINPUT_BUTTON_RIGHT_THUMB]);
+	for (int i = 0; i < MAX_PAD_NUM; i++) {
+		switch (GetConstantInt(DEVICE_CONSTANT_NAME[i]))
+		{
+		case INPUT_DEVICE_GAMEPAD:
+			SetDevice(i, std::make_shared<GamepadDevice>(i));
+			break;
+		case INPUT_DEVICE_KEYBOARD:
+			SetDevice(i, std::make_shared<KeyboardDevice>(GetConstantFloat("MOUSE_SCALE")));
+			break;
+		case INPUT_DEVICE_SCRIPT:
+			SetScriptDevice(i);
+			break;
+		default:
+			SetDevice(i, nullptr);
+			break;
+		}
 	}
-	if (input == INPUT_LEFT_SHOULDER) {
-		return (!_lastPadState[padNum].Buttons[XINPUT_BUTTON_LEFT_SHOULDER] && _padState[padNum].Buttons[XINPUT_BUTTON_LEFT_SHOULDER]);
+}
+
+void Input::SetDevice(int padNum, std::shared_ptr<InputDevice> device)
+{
+	_device[padNum] = device;
+
+	// Ȏu̓͂cȂ悤ɂ
+	_padState[padNum] = {};
+}
+
+void Input::SetScriptDevice(int padNum)
+{
+	// pbhƂɍĐn߂eBbN炷
+	auto device = std::make_shared<VirtualPadDevice>();
+	device->LoadScript(INPUT_SCRIPT_PATH, GetConstantInt("SCRIPT_OFFSET_TICK") * padNum);
+	SetDevice(padNum, device);
+}
+
+void Input::RestartDevices()
+{
+	for (int i = 0; i < MAX_PAD_NUM; i++) {
+		if (!_device[i] || !_device[i]->Restart()) continue;
+
+		_padState[i] = {};
+		for (auto& time : _pressTime[i]) {
+			time = 0;
+		}
 	}
-	if (input == INPUT_RIGHT_SHOULDER) {
-		return (!_lastPadState[padNum].Buttons[XINPUT_BUTTON_RIGHT_SHOULDER] && _padState[padNum].Buttons[XINPUT_BUTTON_RIGHT_SHOULDER]);
+}
+
+void Input::CaptureMouse()
+{
+	_isMouseCaptureRequested = true;
+}
+
+bool Input::IsMouseCaptured() const
+{
+	return _isMouseCaptured;
+}
+
+void Input::Update(long long tickTime)
+{
+	// ÕeBbNŃvC[𓮂ĂƂ}EXD
+	_isMouseCaptured = _isMouseCaptureRequested;
+	_isMouseCaptureRequested = false;
+
+	// ÕeBbNŉĂ{^
+	unsigned int last[MAX_PAD_NUM];
+	for (int i = 0; i < MAX_PAD_NUM; i++) {
+		last[i] = _padState[i].down;
 	}
-	if (input == INPUT_LEFT_TRIGGER) {
-		return (_lastPadState[padNum].LeftTrigger <= 0 && _padState[padNum].LeftTrigger >= 1);
+
+	int padNum = 0;
+
+	for (int i = 0; i < MAX_PAD_NUM; i++) {
+		auto& device = _device[i];
+		if (!device) continue;
+
+		device->Update(tickTime);
+
+		// ̃eBbN܂ł̓͂Âɔf
+		// 1eBbN̊Ԃɓ{^2ςƂ(ZėƂȂ)́A2ڂ玟̃eBbNɉ񂵁A
+		// uԂƗuԂ̂ǂ肱ڂȂ悤ɂ
+		unsigned int changed = 0;
+		PadSample sample;
+		while (device->Peek(tickTime, sample)) {
+			unsigned int diff = sample.buttons ^ _padState[i].down;
+			if (diff & changed) break;
+			changed |= diff;
+
+			// {^͉oĂ
+			SetPressTime(i, sample.buttons & diff, sample.time);
+
+			_padState[i].down = sample.buttons;
+			_padState[i].leftTrigger = sample.leftTrigger;
+			_padState[i].rightTrigger = sample.rightTrigger;
+			_padState[i].thumbLX = sample.thumbLX;
+			_padState[i].thumbLY = sample.thumbLY;
+			_padState[i].thumbRX = sample.thumbRX;
+			_padState[i].thumbRY = sample.thumbRY;
+
+			device->Pop();
+		}
+
+		// ȂĂԑ傫ԍ܂łpbh̐ɂ
+		if (device->IsConnected()) {
+			padNum = i + 1;
+		}
 	}
-	if (input == INPUT_RIGHT_TRIGGER) {
-		return (_lastPadState[padNum].RightTrigger <= 0 && _padState[padNum].RightTrigger >= 1);
+	_padNum = padNum;
+
+	// uԁEĂԁEuԂł܂Ƃ߂ċ߂Ă
+	for (int i = 0; i < MAX_PAD_NUM; i++) {
+		auto& pad = _padState[i];
+		pad.trigger = pad.down & ~last[i];
+		pad.hold = pad.down & last[i];
+		pad.release = ~pad.down & last[i];
 	}
+}
+
+// u
+bool Input::IsTrigger(int input, int padNum) const
+{
+	assert(padNum < _padNum);
+
+	if (input < 0 || input > INPUT_RIGHT_TRIGGER) return false;
 
-	return false;
+	return (_padState[padNum].trigger & INPUT_BIT[input]) != 0;
 }
 
 // Ă
 bool Input::IsHold(int input, int padNum) const
 {
-	if (input == INPUT_A) {
-		return (_lastPadState[padNum].Buttons[XINPUT_BUTTON_A] && _padState[padNum].Buttons[XINPUT_BUTTON_A]);
-	}
-	if (input == INPUT_B) {
-		return (_lastPadState[padNum].Buttons[XINPUT_BUTTON_B] && _padState[padNum].Buttons[XINPUT_BUTTON_B]);
-	}
-	if (input == INPUT_X) {
-		return (_lastPadState[padNum].Buttons[XINPUT_BUTTON_X] && _padState[padNum].Buttons[XINPUT_BUTTON_X]);
-	}
-	if (input == INPUT_Y) {
-		return (_lastPadState[padNum].Buttons[XINPUT_BUTTON_Y] && _padState[padNum].Buttons[XINPUT_BUTTON_Y]);
-	}
-	if (input == INPUT_UP) {
-		return (_lastPadState[padNum].Buttons[XINPUT_BUTTON_DPAD_UP] && _padState[padNum].Buttons[XINPUT_BUTTON_DPAD_UP]);
-	}
-	if (input == INPUT_DOWN) {
-		return (_lastPadState[padNum].Buttons[XINPUT_BUTTON_DPAD_DOWN] && _padState[padNum].Buttons[XINPUT_BUTTON_DPAD_DOWN]);
-	}
-	if (input == INPUT_LEFT) {
-		return (_lastPadState[padNum].Buttons[XINPUT_BUTTON_DPAD_LEFT] && _padState[padNum].Buttons[XINPUT_BUTTON_DPAD_LEFT]);
-	}
-	if (input == INPUT_RIGHT) {
-		return (_lastPadState[padNum].Buttons[XINPUT_BUTTON_DPAD_RIGHT] && _padState[padNum].Buttons[XINPUT_BUTTON_DPAD_RIGHT]);
-	}
-	if (input == INPUT_START) {
-		return (_lastPadState[padNum].Buttons[XINPUT_BUTTON_START] && _padState[padNum].Buttons[XINPUT_BUTTON_START]);
-	}
-	if (input == INPUT_BACK) {
-		return (_lastPadState[padNum].Buttons[XINPUT_BUTTON_BACK] && _padState[padNum].Buttons[XINPUT_BUTTON_BACK]);
-	}
-	if (input == INPUT_LEFT_PUSH) {
-		return (_lastPadState[padNum].Buttons[XINPUT_BUTTON_LEFT_THUMB] && _padState[padNum].Buttons[XINPUT_BUTTON_LEFT_THUMB]);
-	}
-	if (input == INPUT_RIGHT_PUSH) {
-		return (_lastPadState[padNum].Buttons[XINPUT_BUTTON_RIGHT_THUMB] && _padState[padNum].Buttons[XINPUT_BUTTON_RIGHT_THUMB]);
-	}
-	if (input == INPUT_LEFT_SHOULDER) {
-		return (_lastPadState[padNum].Buttons[XINPUT_BUTTON_LEFT_SHOULDER] && _padState[padNum].Buttons[XINPUT_BUTTON_LEFT_SHOULDER]);
-	}
-	if (input == INPUT_RIGHT_SHOULDER) {
-		return (_lastPadState[padNum].Buttons[XINPUT_BUTTON_RIGHT_SHOULDER] && _padState[padNum].Buttons[XINPUT_BUTTON_RIGHT_SHOULDER]);
-	}
-	if (input == INPUT_LEFT_TRIGGER) {
-		return (_lastPadState[padNum].LeftTrigger >= 1 && _padState[padNum].LeftTrigger >= 1);
-	}
-	if (input == INPUT_RIGHT_TRIGGER) {
-		return (_lastPadState[padNum].RightTrigger >= 1 && _padState[padNum].RightTrigger >= 1);
-	}
-	return false;
+	if (input < 0 || input > INPUT_RIGHT_TRIGGER) return false;
+
+	return (_padState[padNum].hold & INPUT_BIT[input]) != 0;
 }
 
 // u
 bool Input::IsRelease(int input, int padNum) const
 {
-	if (input == INPUT_A) {
-		return (_lastPadState[padNum].Buttons[XINPUT_BUTTON_A] && !_padState[padNum].Buttons[XINPUT_BUTTON_A]);
-	}
-	if (input == INPUT_B) {
-		return (_lastPadState[padNum].Buttons[XINPUT_BUTTON_B] && !_padState[padNum].Buttons[XINPUT_BUTTON_B]);
-	}
-	if (input == INPUT_X) {
-		return (_lastPadState[padNum].Buttons[XINPUT_BUTTON_X] && !_padState[padNum].Buttons[XINPUT_BUTTON_X]);
-	}
-	if (input == INPUT_Y) {
-		return (_lastPadState[padNum].Buttons[XINPUT_BUTTON_Y] && !_padState[padNum].Buttons[XINPUT_BUTTON_Y]);
-	}
-	if (input == INPUT_UP) {
-		return (_lastPadState[padNum].Buttons[XINPUT_BUTTON_DPAD_UP] && !_padState[padNum].Buttons[XINPUT_BUTTON_DPAD_UP]);
-	}
-	if (input == INPUT_DOWN) {
-		return (_lastPadState[padNum].Buttons[XINPUT_BUTTON_DPAD_DOWN] && !_padState[padNum].Buttons[XINPUT_BUTTON_DPAD_DOWN]);
-	}
-	if (input == INPUT_LEFT) {
-		return (_lastPadState[padNum].Buttons[XINPUT_BUTTON_DPAD_LEFT] && !_padState[padNum].Buttons[XINPUT_BUTTON_DPAD_LEFT]);
-	}
-	if (input == INPUT_RIGHT) {
-		return (_lastPadState[padNum].Buttons[XINPUT_BUTTON_DPAD_RIGHT] && !_padState[padNum].Buttons[XINPUT_BUTTON_DPAD_RIGHT]);
-	}
-	if (input == INPUT_START) {
-		return (_lastPadState[padNum].Buttons[XINPUT_BUTTON_START] && !_padState[padNum].Buttons[XINPUT_BUTTON_START]);
-	}
-	if (input == INPUT_BACK) {
-		return (_lastPadState[padNum].Buttons[XINPUT_BUTTON_BACK] && !_padState[padNum].Buttons[XINPUT_BUTTON_BACK]);
-	}
-	if (input == INPUT_LEFT_PUSH) {
-		return (_lastPadState[padNum].Buttons[XINPUT_BUTTON_LEFT_THUMB] && !_padState[padNum].Buttons[XINPUT_BUTTON_LEFT_THUMB]);
-	}
-	if (input == INPUT_RIGHT_PUSH) {
-		return (_lastPadState[padNum].Buttons[XINPUT_BUTTON_RIGHT_THUMB] && !_padState[padNum].Buttons[XINPUT_BUTTON_RIGHT_THUMB]);
-	}
-	if (input == INPUT_LEFT_SHOULDER) {
-		return (_lastPadState[padNum].Buttons[XINPUT_BUTTON_LEFT_SHOULDER] && !_padState[padNum].Buttons[XINPUT_BUTTON_LEFT_SHOULDER]);
-	}
-	if (input == INPUT_RIGHT_SHOULDER) {
-		return (_lastPadState[padNum].Buttons[XINPUT_BUTTON_RIGHT_SHOULDER] && !_padState[padNum].Buttons[XINPUT_BUTTON_RIGHT_SHOULDER]);
-	}
-	if (input == INPUT_LEFT_TRIGGER) {
-		return (_lastPadState[padNum].LeftTrigger >= 1 && _padState[padNum].LeftTrigger <= 0);
-	}
-	if (input == INPUT_RIGHT_TRIGGER) {
-		return (_lastPadState[padNum].RightTrigger >= 1 && _padState[padNum].RightTrigger <= 0);
-	}
-	return false;
+	if (input < 0 || input > INPUT_RIGHT_TRIGGER) return false;
+
+	return (_padState[padNum].release & INPUT_BIT[input]) != 0;
 }
 
 bool Input::AnyPressButton(int padNum) const
 {
-	for (auto& button : _padState[padNum].Buttons) {
-		if (button == 1) {
-			return true;
-		}
+	return (_padState[padNum].down & BUTTON_BIT_MASK) != 0;
+}
+
+const PadState& Input::GetPadState(int padNum) const
+{
+	return _padState[padNum];
+}
+
+long long Input::GetPressTime(int input, int padNum) const
+{
+	if (input < 0 || input > INPUT_RIGHT_TRIGGER) return -1;
+
+	long long time = _pressTime[padNum][std::countr_zero(INPUT_BIT[input])];
+	return time == 0 ? -1 : time;
+}
+
+void Input::SetPressTime(int padNum, unsigned int pressed, long long time)
+{
+	for (int bit = 0; pressed != 0; bit++, pressed >>= 1) {
+		if (pressed & 1) _pressTime[padNum][bit] = time;
 	}
-	return false;
 }
 
 Vec3 Input::GetStickVector(int input, int padNum) const
 {
 	if (input == INPUT_LEFT_STICK) {
-		Vec3 vec = { static_cast<float>(_padState[padNum].ThumbLX),0.0f,static_cast<float>(_padState[padNum].ThumbLY) };
+		Vec3 vec = { static_cast<float>(_padState[padNum].thumbLX),0.0f,static_cast<float>(_padState[padNum].thumbLY) };
 		return vec;
 	}
 	if (input == INPUT_RIGHT_STICK) {
-		Vec3 vec = { static_cast<float>(_padState[padNum].ThumbRX),0.0f,static_cast<float>(_padState[padNum].ThumbRY) };
+		Vec3 vec = { static_cast<float>(_padState[padNum].thumbRX),0.0f,static_cast<float>(_padState[padNum].thumbRY) };
 		return vec;
 	}
 	return Vec3();
@@ -212,11 +237,11 @@ Vec3 Input::GetStickVector(int input, int padNum) const
 Vec3 Input::GetStickUnitVector(int input, int padNum) const
 {
 	if (input == INPUT_LEFT_STICK) {
-		Vec3 vec = { static_cast<float>(_padState[padNum].ThumbLX),0.0f,static_cast<float>(_padState[padNum].ThumbLY) };
+		Vec3 vec = { static_cast<float>(_padState[padNum].thumbLX),0.0f,static_cast<float>(_padState[padNum].thumbLY) };
 		return vec.GetNormalized();
 	}
 	if (input == INPUT_RIGHT_STICK) {
-		Vec3 vec = { static_cast<float>(_padState[padNum].ThumbRX),0.0f,static_cast<float>(_padState[padNum].ThumbRY) };
+		Vec3 vec = { static_cast<float>(_padState[padNum].thumbRX),0.0f,static_cast<float>(_padState[padNum].thumbRY) };
 		return vec.GetNormalized();
 	}
 	return Vec3();
@@ -225,11 +250,11 @@ Vec3 Input::GetStickUnitVector(int input, int padNum) const
 float Input::GetStickVectorLength(int input, int padNum) const
 {
 	if (input == INPUT_LEFT_STICK) {
-		Vec3 vec = { static_cast<float>(_padState[padNum].ThumbLX),0.0f,static_cast<float>(_padState[padNum].ThumbLY) };
+		Vec3 vec = { static_cast<float>(_padState[padNum].thumbLX),0.0f,static_cast<float>(_padState[padNum].thumbLY) };
 		return vec.Length();
 	}
 	if (input == INPUT_RIGHT_STICK) {
-		Vec3 vec = { static_cast<float>(_padState[padNum].ThumbRX),0.0f,static_cast<float>(_padState[padNum].ThumbRY) };
+		Vec3 vec = { static_cast<float>(_padState[padNum].thumbRX),0.0f,static_cast<float>(_padState[padNum].thumbRY) };
 		return vec.Length();
 	}
 	return 0.0f;
@@ -238,10 +263,10 @@ float Input::GetStickVectorLength(int input, int padNum) const
 float Input::GetStickThumbX(int input, int padNum) const
 {
 	if (input == INPUT_LEFT_STICK) {
-		return static_cast<float>(_padState[padNum].ThumbLX);
+		return static_cast<float>(_padState[padNum].thumbLX);
 	}
 	if (input == INPUT_RIGHT_STICK) {
-		return static_cast<float>(_padState[padNum].ThumbRX);
+		return static_cast<float>(_padState[padNum].thumbRX);
 	}
 	return 0.0f;
 }
@@ -249,10 +274,10 @@ float Input::GetStickThumbX(int input, int padNum) const
 float Input::GetStickThumbY(int input, int padNum) const
 {
 	if (input == INPUT_LEFT_STICK) {
-		return static_cast<float>(_padState[padNum].ThumbLY);
+		return static_cast<float>(_padState[padNum].thumbLY);
 	}
 	if (input == INPUT_RIGHT_STICK) {
-		return static_cast<float>(_padState[padNum].ThumbRY);
+		return static_cast<float>(_padState[padNum].thumbRY);
 	}
 	return 0.0f;
 }
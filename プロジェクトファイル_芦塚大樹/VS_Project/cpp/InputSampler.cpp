@@ -0,0 +1,127 @@
+#include "InputSampler.h"
+#include <chrono>
+#ifdef _WIN32
+#include <windows.h>
+#include <Xinput.h>
+#pragma comment(lib, "xinput.lib")
+#endif
+
+InputSampler::InputSampler() :
+	_lastSample(),
+	_retryCount(),
+	_isExit(false)
+{
+	for (auto& isConnected : _isConnected) {
+		isConnected = false;
+	}
+}
+
+InputSampler::~InputSampler()
+{
+	Terminate();
+}
+
+void InputSampler::Init()
+{
+	// 萔t@C̓ǂݍ
+	ReadCSV("data/constant/InputSampler.csv");
+
+#ifdef _WIN32
+	if (GetConstatBool("USE_THREAD")) {
+		_thread = std::thread(&InputSampler::SampleLoop, this);
+	}
+#endif
+}
+
+void InputSampler::Terminate()
+{
+	_isExit = true;
+
+	if (_thread.joinable()) {
+		_thread.join();
+	}
+}
+
+bool InputSampler::IsRunning() const
+{
+	return _thread.joinable();
+}
+
+bool InputSampler::IsConnected(int pad) const
+{
+	return _isConnected[pad];
+}
+
+bool InputSampler::Peek(int pad, PadSample& sample) const
+{
+	return _queue[pad].Peek(sample);
+}
+
+void InputSampler::Pop(int pad)
+{
+	_queue[pad].Pop();
+}
+
+long long InputSampler::GetTime()
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void InputSampler::SampleLoop()
+{
+	auto interval = std::chrono::microseconds(GetConstantInt("SAMPLE_INTERVAL"));
+	int retryInterval = GetConstantInt("RETRY_INTERVAL");
+	auto next = std::chrono::steady_clock::now();
+
+	while (!_isExit) {
+		for (int pad = 0; pad < MAX_PAD_NUM; pad++) {
+			// ȂĂȂpbhǂނ͎̂Ԃ̂ŁA܂ɂǂ
+			if (_retryCount[pad] > 0) {
+				_retryCount[pad]--;
+				continue;
+			}
+
+			PadSample sample = {};
+			sample.time = GetTime();
+			_isConnected[pad] = ReadPad(pad, sample);
+			if (!_isConnected[pad]) {
+				_retryCount[pad] = retryInterval;
+			}
+
+			// Oɐς񂾂̂ςĂΐς
+			// (ςŐς߂Ȃ΁Aɓǂ񂾂Ƃɐςݒ)
+			PadSample& last = _lastSample[pad];
+			bool isChanged = sample.buttons != last.buttons ||
+				sample.leftTrigger != last.leftTrigger || sample.rightTrigger != last.rightTrigger ||
+				sample.thumbLX != last.thumbLX || sample.thumbLY != last.thumbLY ||
+				sample.thumbRX != last.thumbRX || sample.thumbRY != last.thumbRY;
+			if (isChanged && _queue[pad].Push(sample)) {
+				last = sample;
+			}
+		}
+
+		next += interval;
+		std::this_thread::sleep_until(next);
+	}
+}
+
+bool InputSampler::ReadPad(int pad, PadSample& sample)
+{
+#ifdef _WIN32
+	XINPUT_STATE state = {};
+	if (XInputGetState(pad, &state) != ERROR_SUCCESS) return false;
+
+	sample.buttons = state.Gamepad.wButtons;
+	if (state.Gamepad.bLeftTrigger >= 1) sample.buttons |= PAD_LEFT_TRIGGER_BIT;
+	if (state.Gamepad.bRightTrigger >= 1) sample.buttons |= PAD_RIGHT_TRIGGER_BIT;
+	sample.leftTrigger = state.Gamepad.bLeftTrigger;
+	sample.rightTrigger = state.Gamepad.bRightTrigger;
+	sample.thumbLX = state.Gamepad.sThumbLX;
+	sample.thumbLY = state.Gamepad.sThumbLY;
+	sample.thumbRX = state.Gamepad.sThumbRX;
+	sample.thumbRY = state.Gamepad.sThumbRY;
+	return true;
+#else
+	return false;
+#endif
+}
@@ -4,7 +4,7 @@
 #include "Vec3.h"
 #include "PlayerManager.h"
 #include "Player.h"
-#include <ctime>
+#include <algorithm>
 #include "StageManager.h"
 #include "Application.h"
 
@@ -15,8 +15,6 @@ ItemManager::ItemManager(std::shared_ptr<PlayerManager>& playerManager, std::sha
 {
 	// 定数ファイルの読み込み
 	ReadCSV("data/constant/ItemManager.csv");
-
-	srand(static_cast<unsigned int>(time(nullptr)));
 }
 
 ItemManager::~ItemManager()
@@ -108,7 +106,7 @@ Vec3 ItemManager::ClosestPointLine(Vec3 itemPos, Vec3 capsuleA, Vec3 capsuleB)
 	float t = AP.dot(AB) / abLenSquared;
 
 	// tを0〜1にクランプ（線分の範囲を超えないように）
-	t = max(0.0f, min(1.0f, t));
+	t = (std::max)(0.0f, (std::min)(1.0f, t));
 
 	// 最近接点を計算
 	return capsuleA + AB * t;
@@ -118,3 +116,9 @@ float ItemManager::DistanceClosestPoint(Vec3 closest, Vec3 itemPos)
 {
 	return (itemPos - closest).Length();
 }
+
+void ItemManager::Reset()
+{
+	_pItem.clear();
+	_frame = 0;
+}
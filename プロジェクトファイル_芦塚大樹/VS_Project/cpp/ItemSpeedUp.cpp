@@ -3,6 +3,7 @@
 #include "ItemManager.h"
 #include "StageManager.h"
 #include "Application.h"
+#include "ModelManager.h"
 
 ItemSpeedUp::ItemSpeedUp(Vec3 pos, std::shared_ptr<StageManager>& stageManager, ItemManager& itemManager):
 	_pStage(stageManager),
@@ -18,7 +19,7 @@ ItemSpeedUp::ItemSpeedUp(Vec3 pos, std::shared_ptr<StageManager>& stageManager,
 	_itemType = ITEM_TYPE_SPEED;
 
 	// f̐ݒ
-	InitModel(MV1LoadModel("data/model/pumpkin.mv1"));	
+	InitModel(ModelManager::GetInstance().Duplicate("data/model/pumpkin.mv1"));	
 }
 
 ItemSpeedUp::~ItemSpeedUp()
@@ -0,0 +1,200 @@
+#include "JobSystem.h"
+#include "DxLib.h"
+#include "TraceRecorder.h"
+#include <algorithm>
+
+namespace {
+	// Ă񂾃Xbh̔ԍ(dsXbh1AȊO0)
+	thread_local int t_jobIndex = 0;
+}
+
+JobSystem::JobSystem() :
+	_queuedNum(0),
+	_isExit(false)
+{
+	// CXbh̗͏̑Og悤ɂĂ
+	_queue.push_back(std::make_unique<Queue>());
+}
+
+JobSystem::~JobSystem()
+{
+	Terminate();
+}
+
+void JobSystem::Init()
+{
+	// 萔t@C̓ǂݍ
+	ReadCSV("data/constant/JobSystem.csv");
+
+	// -1Ȃ烁CXbhȊÕRA̐Ă(0Ȃ烁CXbhōs)
+	int workerNum = GetConstantInt("WORKER_NUM");
+	if (workerNum < 0) {
+		workerNum = (std::max)(static_cast<int>(std::thread::hardware_concurrency()) - 1, 0);
+	}
+
+	StartWorker(workerNum);
+}
+
+void JobSystem::SetWorkerNum(int workerNum)
+{
+	// ̃Xbh~߂āACXbh̗񂾂ɂĂ痧Ē
+	Terminate();
+	_queue.resize(1);
+	_isExit = false;
+
+	StartWorker((std::max)(workerNum, 0));
+}
+
+void JobSystem::Terminate()
+{
+	{
+		std::lock_guard<std::mutex> lock(_sleepMutex);
+		_isExit = true;
+	}
+	_sleepCondition.notify_all();
+
+	for (auto& worker : _worker) {
+		if (worker.joinable()) {
+			worker.join();
+		}
+	}
+	_worker.clear();
+}
+
+void JobSystem::Run(std::function<void()> job, JobCounter& counter)
+{
+	counter.count++;
+
+	auto& queue = *_queue[GetIndex()];
+	{
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		queue.job.push_back(Job{ std::move(job), &counter });
+	}
+	_queuedNum++;
+
+	// ĂXbh1N
+	// (钼ÕXbhƂȂ悤AbNĂm点)
+	{
+		std::lock_guard<std::mutex> lock(_sleepMutex);
+	}
+	_sleepCondition.notify_one();
+}
+
+void JobSystem::Wait(JobCounter& counter)
+{
+	int index = GetIndex();
+	while (counter.count > 0) {
+		// ҂ĂԂds(ȂΎc̎dÎ҂)
+		if (!RunOne(index)) {
+			std::this_thread::yield();
+		}
+	}
+}
+
+void JobSystem::ParallelFor(int count, int grain, const std::function<void(int)>& func)
+{
+	grain = (std::max)(grain, 1);
+
+	// قǂ̐Ȃ΂̂܂܍s
+	if (count <= grain || _worker.empty()) {
+		for (int i = 0; i < count; i++) {
+			func(i);
+		}
+		return;
+	}
+
+	JobCounter counter;
+	for (int begin = 0; begin < count; begin += grain) {
+		int end = (std::min)(begin + grain, count);
+		Run([&func, begin, end]() {
+			for (int i = begin; i < end; i++) {
+				func(i);
+			}
+		}, counter);
+	}
+	Wait(counter);
+}
+
+void JobSystem::Report() const
+{
+	for (int i = 0; i < static_cast<int>(_queue.size()); i++) {
+		LogFileFmtAdd("JobSystem: thread %d executed %d, stolen %d",
+			i, _queue[i]->executedNum.load(), _queue[i]->stolenNum.load());
+	}
+}
+
+void JobSystem::StartWorker(int workerNum)
+{
+	for (int i = 0; i < workerNum; i++) {
+		_queue.push_back(std::make_unique<Queue>());
+	}
+	for (int i = 1; i <= workerNum; i++) {
+		_worker.emplace_back(&JobSystem::WorkerLoop, this, i);
+	}
+}
+
+void JobSystem::WorkerLoop(int index)
+{
+	t_jobIndex = index;
+
+	while (!_isExit) {
+		if (RunOne(index)) continue;
+
+		// ς܂ĂdȂΖ
+		std::unique_lock<std::mutex> lock(_sleepMutex);
+		_sleepCondition.wait(lock, [this]() { return _isExit || _queuedNum > 0; });
+	}
+}
+
+bool JobSystem::RunOne(int index)
+{
+	Job job;
+	bool isFound = false;
+	bool isStolen = false;
+
+	// ̗͌(Ōɐς񂾂)
+	{
+		auto& queue = *_queue[index];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (!queue.job.empty()) {
+			job = std::move(queue.job.back());
+			queue.job.pop_back();
+			isFound = true;
+		}
+	}
+
+	// Ȃׂ̗񂩂珇ɁAO(ŏɐς񂾂)瓐
+	int queueNum = static_cast<int>(_queue.size());
+	for (int i = 1; i < queueNum && !isFound; i++) {
+		auto& queue = *_queue[(index + i) % queueNum];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (!queue.job.empty()) {
+			job = std::move(queue.job.front());
+			queue.job.pop_front();
+			isFound = isStolen = true;
+		}
+	}
+
+	if (!isFound) return false;
+	_queuedNum--;
+
+	// L^ȂdƂ̋Ԃc
+	if (TraceRecorder::GetInstance().IsRecording()) {
+		TraceScope trace(isStolen ? "Job(stolen)" : "Job", "job");
+		job.func();
+	}
+	else {
+		job.func();
+	}
+
+	_queue[index]->executedNum++;
+	if (isStolen) _queue[index]->stolenNum++;
+
+	job.counter->count--;
+	return true;
+}
+
+int JobSystem::GetIndex() const
+{
+	return t_jobIndex;
+}
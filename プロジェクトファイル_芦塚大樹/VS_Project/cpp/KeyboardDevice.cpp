@@ -0,0 +1,118 @@
+#include "KeyboardDevice.h"
+#include "DxLib.h"
+#include "Application.h"
+#include "Input.h"
+#include <algorithm>
+
+namespace {
+	// L[ƃpbh̃{^̃rbg̑g
+	struct KeyBind {
+		int key;
+		unsigned int bit;
+	};
+
+	// L[Ɋ蓖Ă{^
+	// (L[͉EXeBbNɎĝŁA\L[ɂ͊蓖ĂȂ)
+	constexpr KeyBind KEY_BIND[] = {
+		{ KEY_INPUT_SPACE,	1u << XINPUT_BUTTON_A },
+		{ KEY_INPUT_Z,		1u << XINPUT_BUTTON_B },
+		{ KEY_INPUT_E,		1u << XINPUT_BUTTON_X },
+		{ KEY_INPUT_Q,		1u << XINPUT_BUTTON_Y },
+		{ KEY_INPUT_RETURN,	1u << XINPUT_BUTTON_START },
+		{ KEY_INPUT_BACK,	1u << XINPUT_BUTTON_BACK },
+		{ KEY_INPUT_LSHIFT,	1u << XINPUT_BUTTON_LEFT_SHOULDER },
+		{ KEY_INPUT_F,		1u << XINPUT_BUTTON_RIGHT_SHOULDER },
+	};
+
+	// }EX̃{^Ɋ蓖Ă{^
+	constexpr KeyBind MOUSE_BIND[] = {
+		{ MOUSE_INPUT_LEFT,		PAD_RIGHT_TRIGGER_BIT },
+		{ MOUSE_INPUT_RIGHT,	1u << XINPUT_BUTTON_X },
+		{ MOUSE_INPUT_MIDDLE,	1u << XINPUT_BUTTON_Y },
+	};
+
+	// XeBbN|Ƃ̒l
+	constexpr int STICK_MAX = 32767;
+}
+
+KeyboardDevice::KeyboardDevice(float mouseScale) :
+	_mouseScale(mouseScale),
+	_sample(),
+	_hasSample(false)
+{
+}
+
+KeyboardDevice::~KeyboardDevice()
+{
+}
+
+void KeyboardDevice::Update(long long)
+{
+	_sample = {};
+	_sample.time = InputSampler::GetTime();
+
+	for (auto& bind : KEY_BIND) {
+		if (CheckHitKey(bind.key)) _sample.buttons |= bind.bit;
+	}
+
+	int mouse = GetMouseInput();
+	for (auto& bind : MOUSE_BIND) {
+		if (mouse & bind.key) _sample.buttons |= bind.bit;
+	}
+
+	// gK[͉Ă邩ǂȂ̂ŁAĂΉƂɂ
+	if (_sample.buttons & PAD_LEFT_TRIGGER_BIT) _sample.leftTrigger = 255;
+	if (_sample.buttons & PAD_RIGHT_TRIGGER_BIT) _sample.rightTrigger = 255;
+
+	_sample.thumbLX = GetKeyAxis(KEY_INPUT_A, KEY_INPUT_D);
+	_sample.thumbLY = GetKeyAxis(KEY_INPUT_S, KEY_INPUT_W);
+	_sample.thumbRX = GetKeyAxis(KEY_INPUT_LEFT, KEY_INPUT_RIGHT);
+	_sample.thumbRY = GetKeyAxis(KEY_INPUT_DOWN, KEY_INPUT_UP);
+
+	// }EX𓮂ʂEXeBbŇXɂāA}EXʂ̒Sɖ߂
+	// (vC[𓮂ĂȂƂƁAEBhEɂƂ̓}EXDȂ)
+	if (_mouseScale > 0.0f && GetWindowActiveFlag() && Input::GetInstance().IsMouseCaptured()) {
+		auto& app = Application::GetInstance();
+		int centerX = app.GetConstantInt("SCREEN_WIDTH") / 2;
+		int centerY = app.GetConstantInt("SCREEN_HEIGHT") / 2;
+
+		int x = 0;
+		int y = 0;
+		GetMousePoint(&x, &y);
+		SetMousePoint(centerX, centerY);
+
+		if (_sample.thumbRX == 0 && _sample.thumbRY == 0) {
+			_sample.thumbRX = static_cast<short>(std::clamp(static_cast<int>((x - centerX) * _mouseScale), -STICK_MAX, STICK_MAX));
+			_sample.thumbRY = static_cast<short>(std::clamp(static_cast<int>((centerY - y) * _mouseScale), -STICK_MAX, STICK_MAX));
+		}
+	}
+
+	_hasSample = true;
+}
+
+bool KeyboardDevice::Peek(long long, PadSample& sample)
+{
+	if (!_hasSample) return false;
+
+	sample = _sample;
+	return true;
+}
+
+void KeyboardDevice::Pop()
+{
+	_hasSample = false;
+}
+
+bool KeyboardDevice::IsConnected() const
+{
+	return true;
+}
+
+short KeyboardDevice::GetKeyAxis(int negative, int positive)
+{
+	int axis = 0;
+	if (CheckHitKey(negative)) axis -= STICK_MAX;
+	if (CheckHitKey(positive)) axis += STICK_MAX;
+
+	return static_cast<short>(axis);
+}
@@ -0,0 +1,178 @@
+#include "LatencyTracker.h"
+#include "DxLib.h"
+#include "InputSampler.h"
+#include <algorithm>
+#include <fstream>
+
+// e̎(NORMAL_BULLETȂ)̖̏O
+constexpr const char* ACTION_NAME[] = { "NormalBullet", "GrapplerBullet", "BombBullet" };
+constexpr int ACTION_NUM = sizeof(ACTION_NAME) / sizeof(ACTION_NAME[0]);
+
+// iK̖O(CSV̌o)
+constexpr const char* STAGE_NAME[static_cast<int>(LatencyStage::Num)] = { "input", "trigger", "spawn", "effect", "draw", "flip" };
+
+LatencyTracker::LatencyTracker() :
+	_current(-1),
+	_nextId(0)
+{
+	// 萔t@C̓ǂݍ
+	ReadCSV("data/constant/LatencyTracker.csv");
+
+	_summary.resize(ACTION_NUM);
+	for (auto& summary : _summary) {
+		summary.bucket.resize(GetConstantInt("BUCKET_NUM"));
+	}
+	_lastInput.resize(MAX_PAD_NUM * ACTION_NUM, -1);
+}
+
+int LatencyTracker::Begin(int action, int padNum, long long inputTime, long long triggerTime)
+{
+	if (!GetConstatBool("ENABLE")) return -1;
+	if (action < 0 || action >= ACTION_NUM || padNum < 0 || padNum >= MAX_PAD_NUM) return -1;
+	if (inputTime < 0) return -1;
+
+	// ܂܂̘A˂͋L^Ȃ
+	long long& lastInput = _lastInput[padNum * ACTION_NUM + action];
+	if (lastInput == inputTime) return -1;
+	lastInput = inputTime;
+
+	Record record;
+	record.id = _nextId++;
+	record.action = action;
+	std::fill(std::begin(record.time), std::end(record.time), -1);
+	record.time[static_cast<int>(LatencyStage::Input)] = inputTime;
+	record.time[static_cast<int>(LatencyStage::Trigger)] = triggerTime;
+	_pending.push_back(record);
+
+	return record.id;
+}
+
+void LatencyTracker::SetCurrent(int id)
+{
+	_current = id;
+}
+
+void LatencyTracker::Mark(LatencyStage stage)
+{
+	if (_current == -1) return;
+
+	for (auto& record : _pending) {
+		if (record.id != _current) continue;
+
+		long long& time = record.time[static_cast<int>(stage)];
+		if (time < 0) time = InputSampler::GetTime();
+		return;
+	}
+}
+
+void LatencyTracker::OnDraw()
+{
+	// ς݂̒éÃt[ŕ`悳
+	long long now = InputSampler::GetTime();
+	for (auto& record : _pending) {
+		if (record.time[static_cast<int>(LatencyStage::Spawn)] >= 0 && record.time[static_cast<int>(LatencyStage::Draw)] < 0) {
+			record.time[static_cast<int>(LatencyStage::Draw)] = now;
+		}
+	}
+}
+
+void LatencyTracker::OnFlip()
+{
+	long long now = InputSampler::GetTime();
+	int bucketWidth = GetConstantInt("BUCKET_WIDTH");
+	long long timeout = GetConstantInt("PENDING_TIMEOUT");
+
+	for (auto it = _pending.begin(); it != _pending.end();) {
+		if (it->time[static_cast<int>(LatencyStage::Draw)] < 0) {
+			// eoȂ܂܎ԂL^͎̂Ă(N[^CɉƂȂ)
+			if (now - it->time[static_cast<int>(LatencyStage::Input)] > timeout) {
+				it = _pending.erase(it);
+			}
+			else {
+				it++;
+			}
+			continue;
+		}
+		it->time[static_cast<int>(LatencyStage::Flip)] = now;
+
+		// qXgOɑ
+		auto& summary = _summary[it->action];
+		long long latency = now - it->time[static_cast<int>(LatencyStage::Input)];
+		int index = static_cast<int>((std::min)(latency / bucketWidth, static_cast<long long>(summary.bucket.size() - 1)));
+		summary.bucket[index]++;
+		summary.count++;
+		summary.max = (std::max)(summary.max, latency);
+
+		if (static_cast<int>(_done.size()) < GetConstantInt("MAX_RECORD")) {
+			_done.push_back(*it);
+		}
+		it = _pending.erase(it);
+	}
+}
+
+void LatencyTracker::DrawOverlay() const
+{
+	if (!GetConstatBool("ENABLE") || !GetConstatBool("SHOW_OVERLAY")) return;
+
+	int x = GetConstantInt("OVERLAY_X");
+	int y = GetConstantInt("OVERLAY_Y");
+	int bucketWidth = GetConstantInt("BUCKET_WIDTH");
+
+	for (int action = 0; action < ACTION_NUM; action++) {
+		auto& summary = _summary[action];
+
+		DrawFormatString(x, y, 0xffffff, "%s: %d shots  p50 %.1fms  p95 %.1fms  max %.1fms",
+			ACTION_NAME[action], summary.count,
+			GetPercentile(summary, 0.5f) / 1000.0f, GetPercentile(summary, 0.95f) / 1000.0f, summary.max / 1000.0f);
+		y += 20;
+
+		// ԑԂ40ɂ_Ot
+		int peak = (std::max)(*std::max_element(summary.bucket.begin(), summary.bucket.end()), 1);
+		for (int i = 0; i < static_cast<int>(summary.bucket.size()); i++) {
+			int height = summary.bucket[i] * 40 / peak;
+			DrawBox(x + i * 6, y + 40 - height, x + i * 6 + 5, y + 40, 0x00ff80, true);
+		}
+		DrawFormatString(x + static_cast<int>(summary.bucket.size()) * 6 + 8, y + 24, 0xffffff, "%dms/bar", bucketWidth / 1000);
+		y += 50;
+	}
+}
+
+void LatencyTracker::Export(const std::string& path) const
+{
+	if (!GetConstatBool("ENABLE") || _done.empty()) return;
+
+	std::ofstream file(path);
+	if (!file.is_open()) return;
+
+	// ̓{^Ă̎(}CNbAȂiK͋)
+	file << "action";
+	for (auto name : STAGE_NAME) {
+		file << "," << name;
+	}
+	file << "\n";
+
+	for (auto& record : _done) {
+		long long input = record.time[static_cast<int>(LatencyStage::Input)];
+		file << ACTION_NAME[record.action];
+		for (long long time : record.time) {
+			file << ",";
+			if (time >= 0) file << time - input;
+		}
+		file << "\n";
+	}
+}
+
+long long LatencyTracker::GetPercentile(const Summary& summary, float rate) const
+{
+	if (summary.count == 0) return 0;
+
+	int target = static_cast<int>(rate * summary.count);
+	int sum = 0;
+	for (int i = 0; i < static_cast<int>(summary.bucket.size()); i++) {
+		sum += summary.bucket[i];
+		if (sum > target) {
+			return static_cast<long long>(i + 1) * GetConstantInt("BUCKET_WIDTH");
+		}
+	}
+	return summary.max;
+}
@@ -1,11 +1,12 @@
 #include "Logo.h"
 #include "DxLib.h"
 #include "SceneTitle.h"
+#include "AtlasManager.h"
 
 Logo::Logo(SceneTitle& scene)
 {
 	// 摜̃[h
-	_logo = LoadGraph("data/image/TitleLogo.png");
+	_logo = AtlasManager::GetInstance().LoadGraph("data/image/TitleLogo.png");
 
 	// \ʒu̐ݒ
 	_dispPos = Vec2{ scene.GetConstantInt("LOGO_POS_X"),scene.GetConstantInt("LOGO_POS_Y") };
@@ -13,7 +14,7 @@ Logo::Logo(SceneTitle& scene)
 
 Logo::~Logo()
 {
-	DeleteGraph(_logo);
+	AtlasManager::GetInstance().DeleteGraph(_logo);
 }
 
 void Logo::Draw() const
@@ -1,5 +1,6 @@
 #include "MenuButton.h"
 #include "DxLib.h"
+#include "SpriteBatch.h"
 
 MenuButton::MenuButton(Vec2 pos, Vec2 range, int handle, int type) :
 	_pos(pos),
@@ -19,10 +20,10 @@ void MenuButton::Update()
 {
 }
 
-void MenuButton::Draw(int margin) const
+void MenuButton::Record(SpriteBatch& batch, int margin, int layer) const
 {
-	// 摜̕`
-	DrawRotaGraph(_pos.intX(), _pos.intY() + margin, 1.0, 0.0, _graphHandle, true);
+	// 摜̕`L^
+	batch.AddRotaGraph(_pos.intX(), _pos.intY() + margin, 1.0, 0.0, _graphHandle, layer);
 }
 
 Vec2 MenuButton::GetRange() const
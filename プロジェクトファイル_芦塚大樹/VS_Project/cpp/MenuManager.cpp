@@ -8,6 +8,8 @@
 #include "SceneManager.h"
 #include "SoundManager.h"
 #include "SceneTitle.h"
+#include "SpriteBatch.h"
+#include "AtlasManager.h"
 
 MenuManager::MenuManager(int padNum)
 {
@@ -31,30 +33,30 @@ MenuManager::MenuManager(int padNum)
 	_pFinger = std::make_shared<SelectFinger>(padNum);
 
 	// Չ摜̃[h
-	_menuBordHandle = LoadGraph("data/image/Bord.png");
+	_menuBordHandle = AtlasManager::GetInstance().LoadGraph("data/image/Bord.png");
 
 	// wiڂ摜
-	_backHandle = LoadGraph("data/image/backBloom.png");
+	_backHandle = AtlasManager::GetInstance().LoadGraph("data/image/backBloom.png");
 
 	// Չ摜̍W擾
 	_bordPos.x = static_cast<float>(Application::GetInstance().GetConstantInt("SCREEN_WIDTH") / 2);
 	_bordPos.y = static_cast<float>(Application::GetInstance().GetConstantInt("SCREEN_HEIGHT") / 2);
 
 	// ʃ{^摜̃[h
-	_volumeBGMGraph[ZERO_GRAPH] = LoadGraph("data/image/VolumeZeroBGM.png");
-	_volumeBGMGraph[MIN_GRAPH] = LoadGraph("data/image/VolumeMinBGM.png");
-	_volumeBGMGraph[MIDDLE_GRAPH] = LoadGraph("data/image/VolumeMiddleBGM.png");
-	_volumeBGMGraph[MAX_GRAPH] = LoadGraph("data/image/VolumeMaxBGM.png");
+	_volumeBGMGraph[ZERO_GRAPH] = AtlasManager::GetInstance().LoadGraph("data/image/VolumeZeroBGM.png");
+	_volumeBGMGraph[MIN_GRAPH] = AtlasManager::GetInstance().LoadGraph("data/image/VolumeMinBGM.png");
+	_volumeBGMGraph[MIDDLE_GRAPH] = AtlasManager::GetInstance().LoadGraph("data/image/VolumeMiddleBGM.png");
+	_volumeBGMGraph[MAX_GRAPH] = AtlasManager::GetInstance().LoadGraph("data/image/VolumeMaxBGM.png");
 
-	_volumeSEGraph[ZERO_GRAPH] = LoadGraph("data/image/VolumeZeroSE.png");
-	_volumeSEGraph[MIN_GRAPH] = LoadGraph("data/image/VolumeMinSE.png");
-	_volumeSEGraph[MIDDLE_GRAPH] = LoadGraph("data/image/VolumeMiddleSE.png");
-	_volumeSEGraph[MAX_GRAPH] = LoadGraph("data/image/VolumeMaxSE.png");
+	_volumeSEGraph[ZERO_GRAPH] = AtlasManager::GetInstance().LoadGraph("data/image/VolumeZeroSE.png");
+	_volumeSEGraph[MIN_GRAPH] = AtlasManager::GetInstance().LoadGraph("data/image/VolumeMinSE.png");
+	_volumeSEGraph[MIDDLE_GRAPH] = AtlasManager::GetInstance().LoadGraph("data/image/VolumeMiddleSE.png");
+	_volumeSEGraph[MAX_GRAPH] = AtlasManager::GetInstance().LoadGraph("data/image/VolumeMaxSE.png");
 
 	// e{^̍쐬Əݒ
-	_pButton[0] = std::make_shared<MenuButton>(Vec2{ GetConstantInt("CANCEL_POS_X"),GetConstantInt("CANCEL_POS_Y") }, Vec2{ GetConstantInt("CANCEL_RANGE_X"),GetConstantInt("CANCEL_RANGE_Y") }, LoadGraph("data/image/Cancel.png"), BATU_BUTTON);
-	_pButton[1] = std::make_shared<MenuButton>(Vec2{ GetConstantInt("MANUAL_POS_X"),_bordPos.intY() }, Vec2{ GetConstantInt("MANUAL_RANGE_X"),GetConstantInt("MANUAL_RANGE_Y") }, LoadGraph("data/image/Manual.png"), MANUAL_BUTTON);
-	_pButton[4] = std::make_shared<MenuButton>(Vec2{ _bordPos.intX(),GetConstantInt("END_POS_Y") }, Vec2{ GetConstantInt("END_RANGE_X"),GetConstantInt("END_RANGE_Y") }, LoadGraph("data/image/End.png"), END_BUTTON);
+	_pButton[0] = std::make_shared<MenuButton>(Vec2{ GetConstantInt("CANCEL_POS_X"),GetConstantInt("CANCEL_POS_Y") }, Vec2{ GetConstantInt("CANCEL_RANGE_X"),GetConstantInt("CANCEL_RANGE_Y") }, AtlasManager::GetInstance().LoadGraph("data/image/Cancel.png"), BATU_BUTTON);
+	_pButton[1] = std::make_shared<MenuButton>(Vec2{ GetConstantInt("MANUAL_POS_X"),_bordPos.intY() }, Vec2{ GetConstantInt("MANUAL_RANGE_X"),GetConstantInt("MANUAL_RANGE_Y") }, AtlasManager::GetInstance().LoadGraph("data/image/Manual.png"), MANUAL_BUTTON);
+	_pButton[4] = std::make_shared<MenuButton>(Vec2{ _bordPos.intX(),GetConstantInt("END_POS_Y") }, Vec2{ GetConstantInt("END_RANGE_X"),GetConstantInt("END_RANGE_Y") }, AtlasManager::GetInstance().LoadGraph("data/image/End.png"), END_BUTTON);
 
 	auto& sound = SoundManager::GetInstance();
 
@@ -96,21 +98,29 @@ MenuManager::MenuManager(int padNum)
 
 	// j[J炷
 	SoundManager::GetInstance().RingSE(SE_OPEN_MENU);
+
+	// ŏ̕`eL^
+	Record();
 }
 
 MenuManager::~MenuManager()
 {
-	DeleteGraph(_menuBordHandle);
-	DeleteGraph(_backHandle);
+	AtlasManager::GetInstance().DeleteGraph(_menuBordHandle);
+	AtlasManager::GetInstance().DeleteGraph(_backHandle);
 	for (int i = 0; i < MAX_GRAPH; i++) {
-		DeleteGraph(_volumeBGMGraph[i]);
-		DeleteGraph(_volumeSEGraph[i]);
+		AtlasManager::GetInstance().DeleteGraph(_volumeBGMGraph[i]);
+		AtlasManager::GetInstance().DeleteGraph(_volumeSEGraph[i]);
 	}
 }
 
 void MenuManager::Update()
 {
 	(this->*_updateFunc)();
+
+	// XCh{^̉摜ςƂL^
+	if (_isRecordDirty || _recordMargin != _margin) {
+		Record();
+	}
 }
 
 void MenuManager::Draw() const
@@ -197,6 +207,7 @@ void MenuManager::NormalUpdate()
 			default:
 				break;
 			}
+			_isRecordDirty = true;
 			break;
 		case BGM_BUTTON:
 			// TEhƓ
@@ -225,6 +236,7 @@ void MenuManager::NormalUpdate()
 			default:
 				break;
 			}
+			_isRecordDirty = true;
 			break;
 		case END_BUTTON:
 			// ItO𗧂Ă
@@ -240,15 +252,8 @@ void MenuManager::NormalUpdate()
 
 void MenuManager::NormalDraw() const
 {
-	// ڂ̕`
-	DrawGraph(1, 0, _backHandle, true);
-
-	// Ղ̕`
-	DrawRotaGraph(_bordPos.intX(), _bordPos.intY() + _margin, 1.0, 0.0, _menuBordHandle, true);
-
-	for (auto& button : _pButton) {
-		button->Draw(_margin);
-	}
+	// ڂAՁA{^̕`
+	_batch.Draw();
 
 	// w̕`
 	_pFinger->Draw();
@@ -312,6 +317,25 @@ void MenuManager::EndUpdate()
 }
 
 
+void MenuManager::Record()
+{
+	_batch.Clear();
+
+	// ڂ
+	_batch.AddGraph(1, 0, _backHandle, 0);
+
+	// 
+	_batch.AddRotaGraph(_bordPos.intX(), _bordPos.intY() + _margin, 1.0, 0.0, _menuBordHandle, 1);
+
+	// {^
+	for (auto& button : _pButton) {
+		button->Record(_batch, _margin, 2);
+	}
+
+	_recordMargin = _margin;
+	_isRecordDirty = false;
+}
+
 void MenuManager::EndDraw() const
 {
 	auto& app = Application::GetInstance();
@@ -0,0 +1,96 @@
+#include "ModelManager.h"
+#include "DxLib.h"
+#include "TraceRecorder.h"
+
+int ModelManager::Duplicate(const std::string& path)
+{
+	auto it = _source.find(path);
+
+	// ߂ĎgfȂǂݍ
+	if (it == _source.end()) {
+		TraceScope trace("MV1LoadModel", "load", path);
+		int handle = MV1LoadModel(path.c_str());
+		if (handle == -1) return -1;
+
+		it = _source.emplace(path, Source{ handle, 0 }).first;
+	}
+
+	// f畡
+	int instance = MV1DuplicateModel(it->second.handle);
+	if (instance == -1) return -1;
+
+	it->second.refCount++;
+	_instance[instance] = path;
+
+	return instance;
+}
+
+int ModelManager::Preload(const std::string& path)
+{
+	// ǂݍݍς݂Ȃ牽Ȃ
+	auto it = _source.find(path);
+	if (it != _source.end()) return it->second.handle;
+
+	SetUseASyncLoadFlag(TRUE);
+	int handle = MV1LoadModel(path.c_str());
+	SetUseASyncLoadFlag(FALSE);
+	if (handle == -1) return -1;
+
+	// ܂ł͎QƐ0̂܂܎Ă
+	_source.emplace(path, Source{ handle, 0 });
+
+	return handle;
+}
+
+void ModelManager::Release(int handle)
+{
+	MV1DeleteModel(handle);
+
+	// ǗĂ镡ȂQƂ炷
+	auto it = _instance.find(handle);
+	if (it == _instance.end()) return;
+
+	auto source = _source.find(it->second);
+	if (source != _source.end()) {
+		source->second.refCount--;
+	}
+
+	_instance.erase(it);
+}
+
+void ModelManager::ReleaseUnused()
+{
+	for (auto it = _source.begin(); it != _source.end();) {
+		if (it->second.refCount <= 0) {
+			MV1DeleteModel(it->second.handle);
+			it = _source.erase(it);
+		}
+		else {
+			it++;
+		}
+	}
+}
+
+void ModelManager::Report() const
+{
+	long long total = 0;
+
+	LogFileFmtAdd("ModelManager: %d models resident", static_cast<int>(_source.size()));
+	for (auto& source : _source) {
+
+		// t@CTCYƃeNX`̃TCYgp̖ڈo
+		// (A[JCuɓĂꍇ̂DxLiboRŃTCY)
+		long long bytes = FileRead_size(source.first.c_str());
+		if (bytes < 0) bytes = 0;
+		for (int i = 0; i < MV1GetTextureNum(source.second.handle); i++) {
+			int width = 0;
+			int height = 0;
+			GetGraphSize(MV1GetTextureGraphHandle(source.second.handle, i), &width, &height);
+			bytes += static_cast<long long>(width) * height * 4;
+		}
+
+		LogFileFmtAdd("  %s : %d instances, %lld KB", source.first.c_str(), source.second.refCount, bytes / 1024);
+		total += bytes;
+	}
+	LogFileFmtAdd("ModelManager: total %lld KB", total / 1024);
+}
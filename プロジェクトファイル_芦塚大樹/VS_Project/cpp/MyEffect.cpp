@@ -1,11 +1,18 @@
 #include "MyEffect.h"
-#include "EffekseerForDXLib.h"
 #include "EffectManager.h"
+#include "LatencyTracker.h"
+
+MyEffect::MyEffect() :
+	_instance(-1)
+{
+}
 
 MyEffect::MyEffect(int effect,Vec3 pos)
 {
-	_playHandle = PlayEffekseer3DEffect(EffectManager::GetInstance().GetEffectHandle(effect));
-	SetPosPlayingEffekseer3DEffect(_playHandle, pos.x, pos.y, pos.z);
+	_instance = EffectManager::GetInstance().Play(effect, pos);
+
+	// ͂̒x̌v(eƂ́Ae̍ŏ̃GtFNg)
+	LatencyTracker::GetInstance().Mark(LatencyStage::Effect);
 }
 
 MyEffect::~MyEffect()
@@ -15,21 +22,21 @@ MyEffect::~MyEffect()
 void MyEffect::Update(Vec3 pos)
 {
 	// GtFNg̈ړ
-	SetPosPlayingEffekseer3DEffect(_playHandle, pos.x, pos.y, pos.z);
+	EffectManager::GetInstance().SetPos(_instance, pos);
 }
 
 void MyEffect::StopEffect()
 {
-	StopEffekseer3DEffect(_playHandle);
+	EffectManager::GetInstance().Stop(_instance);
 }
 
 void MyEffect::StartEffect()
 {
-	StopEffekseer3DEffect(_playHandle);
+	EffectManager::GetInstance().Stop(_instance);
 }
 
 void MyEffect::SetScaleEffect(Vec3 scale)
 {
 	// GtFNg̃XP[ݒ
-	SetScalePlayingEffekseer3DEffect(_playHandle, scale.x, scale.y, scale.z);
+	EffectManager::GetInstance().SetScale(_instance, scale);
 }
@@ -25,7 +25,7 @@ NormalBullet::NormalBullet(Vec3 dist, Vec3 pos, std::shared_ptr<MapBulletCollisi
 	_distVec = dist;
 
 	// GtFNgCX^X̍쐬
-	_pEffect = std::make_shared<MyEffect>(NORMAL_BULLET_EFFECT, pos);
+	_effect = MyEffect(NORMAL_BULLET_EFFECT, pos);
 
 	// a̐ݒ
 	_radius = _bulletManager.GetConstantFloat("RADIUS");
@@ -34,10 +34,10 @@ NormalBullet::NormalBullet(Vec3 dist, Vec3 pos, std::shared_ptr<MapBulletCollisi
 NormalBullet::~NormalBullet()
 {
 	if (_frame == 0) {
-		_pEffect->StopEffect();
+		_effect.StopEffect();
 	}
 	else if (!_deadFlag) {
-		_destroyEffect->StopEffect();
+		_destroyEffect.StopEffect();
 	}
 }
 
@@ -54,7 +54,7 @@ void NormalBullet::Update()
 		if (_collManager->CollisionBullet(Position, _radius, NORMAL_BULLET)) {
 
 			// e炷
-			SoundManager::GetInstance().RingSE(SE_DESTRUCTION);
+			SoundManager::GetInstance().RingSE(SE_DESTRUCTION, Position);
 
 			// ̏
 			CollisionFunction();
@@ -64,20 +64,20 @@ void NormalBullet::Update()
 		float deadLine = _bulletManager.GetConstantFloat("DEAD_LINE");
 		if (abs(Position.x) >= deadLine || abs(Position.y) >= deadLine || abs(Position.z) >= deadLine) {
 			_deadFlag = true;
-			_pEffect->StopEffect();
+			_effect.StopEffect();
 		}
 	}
 	else {
-		_destroyEffect->Update(Position);
+		_destroyEffect.Update(Position);
 		_frame++;
 		if (_frame > Application::GetInstance().GetConstantInt("FRAME_NUM")) {
 			_deadFlag = true;
-			_destroyEffect->StopEffect();
+			_destroyEffect.StopEffect();
 		}
 	}
 
 	// GtFNg̍XV
-	_pEffect->Update(Position);
+	_effect.Update(Position);
 }
 
 void NormalBullet::Draw() const
@@ -96,7 +96,7 @@ void NormalBullet::CollisionFunction()
 {
 	_playerCollisionFlag = true;
 	_frame = 1;
-	_pEffect->StopEffect();
-	_destroyEffect = std::make_shared<MyEffect>(BLOCK_DESTROY_EFFECT, Position);
-	_destroyEffect->SetScaleEffect(Vec3{ 0.1f,0.1f,0.1f });
+	_effect.StopEffect();
+	_destroyEffect = MyEffect(BLOCK_DESTROY_EFFECT, Position);
+	_destroyEffect.SetScaleEffect(Vec3{ 0.1f,0.1f,0.1f });
 }
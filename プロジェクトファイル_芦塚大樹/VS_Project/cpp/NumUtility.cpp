@@ -1,23 +1,25 @@
 #include "NumUtility.h"
 #include "DxLib.h"
+#include "AtlasManager.h"
 
 NumUtility::NumUtility(float size, Vec2 pos, int num):
 	_drawPos(pos),
-	_size(size)
+	_size(size),
+	_time(num)
 {
 
 	// 摜̃[h
-	_numHandle[NUM_0] = LoadGraph("data/image/Num0.png");
-	_numHandle[NUM_1] = LoadGraph("data/image/Num1.png");
-	_numHandle[NUM_2] = LoadGraph("data/image/Num2.png");
-	_numHandle[NUM_3] = LoadGraph("data/image/Num3.png");
-	_numHandle[NUM_4] = LoadGraph("data/image/Num4.png");
-	_numHandle[NUM_5] = LoadGraph("data/image/Num5.png");
-	_numHandle[NUM_6] = LoadGraph("data/image/Num6.png");
-	_numHandle[NUM_7] = LoadGraph("data/image/Num7.png");
-	_numHandle[NUM_8] = LoadGraph("data/image/Num8.png");
-	_numHandle[NUM_9] = LoadGraph("data/image/Num9.png");
-	_numHandle[NUM_DOT] = LoadGraph("data/image/NumDot.png");
+	_numHandle[NUM_0] = AtlasManager::GetInstance().LoadGraph("data/image/Num0.png");
+	_numHandle[NUM_1] = AtlasManager::GetInstance().LoadGraph("data/image/Num1.png");
+	_numHandle[NUM_2] = AtlasManager::GetInstance().LoadGraph("data/image/Num2.png");
+	_numHandle[NUM_3] = AtlasManager::GetInstance().LoadGraph("data/image/Num3.png");
+	_numHandle[NUM_4] = AtlasManager::GetInstance().LoadGraph("data/image/Num4.png");
+	_numHandle[NUM_5] = AtlasManager::GetInstance().LoadGraph("data/image/Num5.png");
+	_numHandle[NUM_6] = AtlasManager::GetInstance().LoadGraph("data/image/Num6.png");
+	_numHandle[NUM_7] = AtlasManager::GetInstance().LoadGraph("data/image/Num7.png");
+	_numHandle[NUM_8] = AtlasManager::GetInstance().LoadGraph("data/image/Num8.png");
+	_numHandle[NUM_9] = AtlasManager::GetInstance().LoadGraph("data/image/Num9.png");
+	_numHandle[NUM_DOT] = AtlasManager::GetInstance().LoadGraph("data/image/NumDot.png");
 
 	_drawNumHandle[0] = 0;
 	_drawNumHandle[1] = 0;
@@ -45,24 +47,28 @@ NumUtility::NumUtility(float size, Vec2 pos, int num):
 	_drawNumHandle[3] = _numHandle[b % 10];
 	_drawNumHandle[4] = _numHandle[a / 10];
 	_drawNumHandle[5] = _numHandle[a % 10];
+
+	// \͕ςȂ̂ňxL^
+	Record();
 }
 
 NumUtility::NumUtility(float size, Vec2 pos):
 	_drawPos(pos),
-	_size(size)
+	_size(size),
+	_time(-1)
 {
 	// 摜̃[h
-	_numHandle[NUM_0] = LoadGraph("data/image/Num0.png");
-	_numHandle[NUM_1] = LoadGraph("data/image/Num1.png");
-	_numHandle[NUM_2] = LoadGraph("data/image/Num2.png");
-	_numHandle[NUM_3] = LoadGraph("data/image/Num3.png");
-	_numHandle[NUM_4] = LoadGraph("data/image/Num4.png");
-	_numHandle[NUM_5] = LoadGraph("data/image/Num5.png");
-	_numHandle[NUM_6] = LoadGraph("data/image/Num6.png");
-	_numHandle[NUM_7] = LoadGraph("data/image/Num7.png");
-	_numHandle[NUM_8] = LoadGraph("data/image/Num8.png");
-	_numHandle[NUM_9] = LoadGraph("data/image/Num9.png");
-	_numHandle[NUM_DOT] = LoadGraph("data/image/NumDot.png");
+	_numHandle[NUM_0] = AtlasManager::GetInstance().LoadGraph("data/image/Num0.png");
+	_numHandle[NUM_1] = AtlasManager::GetInstance().LoadGraph("data/image/Num1.png");
+	_numHandle[NUM_2] = AtlasManager::GetInstance().LoadGraph("data/image/Num2.png");
+	_numHandle[NUM_3] = AtlasManager::GetInstance().LoadGraph("data/image/Num3.png");
+	_numHandle[NUM_4] = AtlasManager::GetInstance().LoadGraph("data/image/Num4.png");
+	_numHandle[NUM_5] = AtlasManager::GetInstance().LoadGraph("data/image/Num5.png");
+	_numHandle[NUM_6] = AtlasManager::GetInstance().LoadGraph("data/image/Num6.png");
+	_numHandle[NUM_7] = AtlasManager::GetInstance().LoadGraph("data/image/Num7.png");
+	_numHandle[NUM_8] = AtlasManager::GetInstance().LoadGraph("data/image/Num8.png");
+	_numHandle[NUM_9] = AtlasManager::GetInstance().LoadGraph("data/image/Num9.png");
+	_numHandle[NUM_DOT] = AtlasManager::GetInstance().LoadGraph("data/image/NumDot.png");
 
 	_drawNumHandle[0] = 0;
 	_drawNumHandle[1] = 0;
@@ -76,12 +82,16 @@ NumUtility::~NumUtility()
 {
 	// 摜̃f[g
 	for (int i = 0; i <= NUM_DOT; i++) {
-		DeleteGraph(_numHandle[i]);
+		AtlasManager::GetInstance().DeleteGraph(_numHandle[i]);
 	}
 }
 
 void NumUtility::Update(int time)
 {
+	// ԂςĂȂ΋L^Ȃ
+	if (time == _time) return;
+	_time = time;
+
 	int a = time;	// _ȉ
 	int b = 0;	// b
 	int c = 0;	// 
@@ -101,21 +111,40 @@ void NumUtility::Update(int time)
 	_drawNumHandle[3] = _numHandle[b % 10];
 	_drawNumHandle[4] = _numHandle[a / 10];
 	_drawNumHandle[5] = _numHandle[a % 10];
+
+	Record();
+}
+
+void NumUtility::Reset()
+{
+	_time = -1;
+	for (auto& handle : _drawNumHandle) {
+		handle = 0;
+	}
+	_batch.Clear();
 }
 
 void NumUtility::Draw() const
 {
+	// L^܂Ƃ߂ĕ`
+	_batch.Draw();
+}
+
+void NumUtility::Record()
+{
+	_batch.Clear();
+
 	int n = 0;
 	int i = 1;
 	while (i <= 8) {
 		//DrawGraph(_drawPos.intX() + 100 * i , _drawPos.intY(), _drawNumHandle[n], true);
-		DrawRotaGraph(static_cast<int>(_drawPos.x + (100 * _size) * i), static_cast<int>(_drawPos.y), _size, 0.0, _drawNumHandle[n], true);
+		_batch.AddRotaGraph(static_cast<int>(_drawPos.x + (100 * _size) * i), static_cast<int>(_drawPos.y), _size, 0.0, _drawNumHandle[n]);
 		n++;
 
 		if (n % 2 == 0 && n != 6) {
 			i++;
 			//DrawGraph(_drawPos.intX() + 100 * i, _drawPos.intY(), _numHandle[NUM_DOT], true);
-			DrawRotaGraph(static_cast<int>(_drawPos.x + (100 * _size) * i), static_cast<int>(_drawPos.y), _size, 0.0, _numHandle[NUM_DOT], true);
+			_batch.AddRotaGraph(static_cast<int>(_drawPos.x + (100 * _size) * i), static_cast<int>(_drawPos.y), _size, 0.0, _numHandle[NUM_DOT]);
 		}
 		i++;
 	}
@@ -12,6 +12,8 @@
 #include "ItemManager.h"
 #include "Application.h"
 #include "Constant.h"
+#include "InputSampler.h"
+#include "LatencyTracker.h"
 
 Player::Player(std::shared_ptr<BulletManager>& bullet, PlayerManager& manager, int padNum, BulletData& data) :
 	_moveScaleY(0),
@@ -58,7 +60,7 @@ Player::Player(std::shared_ptr<BulletManager>& bullet, PlayerManager& manager, i
 	}
 
 	// GtFNgCX^X̍쐬
-	_pEffect = std::make_shared<MyEffect>(SPEED_UP_EFFECT, Position);
+	_effect = MyEffect(SPEED_UP_EFFECT, Position);
 
 	// IĂȅ
 	_bulletData._selectBullet = NORMAL_BULLET;
@@ -84,9 +86,6 @@ Player::Player(std::shared_ptr<BulletManager>& bullet, PlayerManager& manager, B
 	_controlFunc = &Player::ControlAI;
 	_updateFunc = &Player::UpdateAI;
 
-	// ̏
-	srand(static_cast<unsigned int>(time(nullptr)));
-
 	// g̐ݒ
 	Scale = manager.GetConstantFloat("MODEL_SCALE");
 
@@ -109,7 +108,7 @@ Player::Player(std::shared_ptr<BulletManager>& bullet, PlayerManager& manager, B
 	}
 
 	// GtFNgCX^X̍쐬
-	_pEffect = std::make_shared<MyEffect>(SPEED_UP_EFFECT, Position);
+	_effect = MyEffect(SPEED_UP_EFFECT, Position);
 
 	// IĂȅ
 	_bulletData._selectBullet = NORMAL_BULLET;
@@ -139,10 +138,11 @@ void Player::Update()
 
 	// Xs[htÕt[v
 	if (_speedUpFrag) {
-		_pEffect->Update(Position);
+		Vec3 pos = Position;
+		_command.Push([this, pos]() { _effect.Update(pos); });
 		_speedUpFrame++;
 		if (_speedUpFrame > _manager.GetConstantInt("SPEED_UP_TIME")) {
-			_pEffect->StopEffect();
+			_command.Push([this]() { _effect.StopEffect(); });
 			_speedUpFrag = false;
 			_speedUpFrame = 0;
 		}
@@ -244,7 +244,9 @@ void Player::ControlPl()
 		_moveScaleY = _manager.GetConstantFloat("JUMP_SCALE");
 
 		// Wv̊JnAj[VĐ
-		ChangeAnimation(_modelHandle, _manager.GetConstantInt("ANIM_JUMP_UP"), false, _manager.GetConstantFloat("BLEND_RATE"));
+		_command.Push([this]() {
+			ChangeAnimation(_modelHandle, _manager.GetConstantInt("ANIM_JUMP_UP"), false, _manager.GetConstantFloat("BLEND_RATE"));
+		});
 	}
 
 	// ÿړ
@@ -406,7 +408,7 @@ void Player::UpdatePl()
 	if (_bulletManager->IsCollisionBullet(_padNum) && !_bulletManager->GetInvalidFlag(_padNum)) {
 
 		// e̖
-		_bulletManager->KillBullet(_padNum);
+		_command.Push([this]() { _bulletManager->KillBullet(_padNum); });
 
 		// ĂƃObv[̕ɈړxNg^
 		if (_groundFlag) {
@@ -428,28 +430,33 @@ void Player::UpdatePl()
 		}
 	}
 
-	// J̍XV
-	_pCamera->Update(Position, _forwardVec, Angle);
+	// J̍XV(Cg̊pxݒ肷̂ŃCXbhōs)
+	_command.Push([this, pos = Position, forward = _forwardVec, angle = Angle]() {
+		_pCamera->Update(pos, forward, angle);
+	});
 
 	// Aj[VRg[                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
-	AnimationContorol();
+	// (Aj[VƃfDxLibœ̂ŁA܂Ƃ߂ăCXbhōs)
+	_command.Push([this]() {
+		AnimationContorol();
 
-	// Aj[V̍XV
-	if (_speedUpFrag) {
-		UpdateAnimation(_modelHandle, _manager.GetConstantFloat("ANIM_SPEED_UP_WALK"));
-	}
-	else {
-		UpdateAnimation(_modelHandle, _manager.GetConstantFloat("ANIM_SPEED_WALK"));
-	}
+		// Aj[V̍XV
+		if (_speedUpFrag) {
+			UpdateAnimation(_modelHandle, _manager.GetConstantFloat("ANIM_SPEED_UP_WALK"));
+		}
+		else {
+			UpdateAnimation(_modelHandle, _manager.GetConstantFloat("ANIM_SPEED_WALK"));
+		}
 
-	// fp̃gXtH[쐬
-	Transform trans;
-	trans.Scale = Scale;
-	trans.Position = Position;
-	trans.Angle = Vec3{ Angle.x,Angle.y - DX_PI_F / 2, Angle.z };
+		// fp̃gXtH[쐬
+		Transform trans;
+		trans.Scale = Scale;
+		trans.Position = Position;
+		trans.Angle = Vec3{ Angle.x,Angle.y - DX_PI_F / 2, Angle.z };
 
-	// f̍XV
-	UpdateModel(trans);
+		// f̍XV
+		UpdateModel(trans);
+	});
 }
 
 void Player::UpdateAI()
@@ -497,7 +504,7 @@ void Player::UpdateAI()
 	if (_bulletManager->IsCollisionBullet(_padNum) && !_bulletManager->GetInvalidFlag(_padNum)) {
 
 		// e̖
-		_bulletManager->KillBullet(_padNum);
+		_command.Push([this]() { _bulletManager->KillBullet(_padNum); });
 
 		// ĂƃObv[̕ɈړxNg^
 		if (_groundFlag) {
@@ -520,24 +527,27 @@ void Player::UpdateAI()
 	}
 
 	// Aj[VRg[                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
-	AnimationContorol();
+	// (Aj[VƃfDxLibœ̂ŁA܂Ƃ߂ăCXbhōs)
+	_command.Push([this]() {
+		AnimationContorol();
 
-	// Aj[V̍XV
-	if (_speedUpFrag) {
-		UpdateAnimation(_modelHandle, _manager.GetConstantFloat("ANIM_SPEED_UP_WALK"));
-	}
-	else {
-		UpdateAnimation(_modelHandle, _manager.GetConstantFloat("ANIM_SPEED_WALK"));
-	}
+		// Aj[V̍XV
+		if (_speedUpFrag) {
+			UpdateAnimation(_modelHandle, _manager.GetConstantFloat("ANIM_SPEED_UP_WALK"));
+		}
+		else {
+			UpdateAnimation(_modelHandle, _manager.GetConstantFloat("ANIM_SPEED_WALK"));
+		}
 
-	// fp̃gXtH[쐬
-	Transform trans;
-	trans.Scale = Scale;
-	trans.Position = Position;
-	trans.Angle = Vec3{ Angle.x,Angle.y - DX_PI_F / 2, Angle.z };
+		// fp̃gXtH[쐬
+		Transform trans;
+		trans.Scale = Scale;
+		trans.Position = Position;
+		trans.Angle = Vec3{ Angle.x,Angle.y - DX_PI_F / 2, Angle.z };
 
-	// f̍XV
-	UpdateModel(trans);
+		// f̍XV
+		UpdateModel(trans);
+	});
 }
 
 void Player::Draw() const
@@ -576,7 +586,7 @@ void Player::Draw() const
 void Player::CameraSet() const
 {
 	// J̃^[QbgƍWݒ肷
-	SetCameraPositionAndTarget_UpVecY(_pCamera->Position.VGet(), _pCamera->GetTarget().VGet());
+	SetCameraPositionAndTarget_UpVecY(_pCamera->GetDrawPosition().VGet(), _pCamera->GetDrawTarget().VGet());
 }
 
 bool Player::GetGroundFlag() const
@@ -623,7 +633,7 @@ void Player::GiveItem(int itemType)
 	switch (itemType)
 	{
 	case ITEM_TYPE_SPEED:	// Xs[hAbv
-		_pEffect = std::make_shared<MyEffect>(SPEED_UP_EFFECT, Position);
+		_effect = MyEffect(SPEED_UP_EFFECT, Position);
 
 		if (_speedUpFrag) {
 			_speedUpFrame = 0;
@@ -638,6 +648,71 @@ void Player::GiveItem(int itemType)
 	}
 }
 
+bool Player::IsAi() const
+{
+	return _controlFunc == &Player::ControlAI;
+}
+
+void Player::Reset()
+{
+	// RXgN^ŏlɖ߂
+	_moveScaleY = 0;
+	_groundFlag = false;
+	_groundCount = 0;
+	_grapplerScale = 0;
+	_deadFlag = false;
+	_frame = 0;
+	_stunFrag = false;
+	_stunFrame = 0;
+	_speedUpFrag = false;
+	_speedUpFrame = 0;
+	_frontPos = Vec3{};
+	_moveVec = Vec3{};
+	_forwardVec = Vec3{};
+	_grapplerUnitVec = Vec3{};
+
+	// gXtH[̐ݒ
+	Scale = _manager.GetConstantFloat("MODEL_SCALE");
+	Position = Vec3{ 0.0f,25.0f,0.0f };
+	Angle = Vec3{};
+
+	// JvZ̏
+	_capsuleData = CapsuleData{};
+	InitCapsule(Position, _manager.GetConstantFloat("CAPSULE_RADIUS"), _manager.GetConstantFloat("CAPSULE_HEIGHT"));
+	Aactivation();
+
+	// Aj[Vƃf̕Ԃ̒ɖ߂
+	ResetAnimation(_modelHandle);
+	ResetModel();
+
+	// J̕Ԃ߂ɂ
+	if (_pCamera) {
+		_pCamera->Reset();
+	}
+
+	// N[^CƑIĂȅ
+	for (auto& time : _bulletData._bullletCoolTime) {
+		time = 0;
+	}
+	_bulletData._selectBullet = NORMAL_BULLET;
+
+	// GtFNg~߂č蒼
+	_effect.StopEffect();
+	_effect = MyEffect(SPEED_UP_EFFECT, Position);
+
+	_oldPos = IsAi() ? Position : Vec3{};
+}
+
+void Player::BeginDefer()
+{
+	_command.Begin();
+}
+
+void Player::ExecuteDeferred()
+{
+	_command.Execute();
+}
+
 void Player::RotateAngleY(float targetAngle)
 {
 	// sړxNg0ȂƂpxvZ
@@ -756,19 +831,13 @@ void Player::AnimationContorol()
 
 void Player::BulletTrigger(int bullet)
 {
-	// ˂W
-	Vec3 pos = MV1GetFramePosition(GetModelHandle(), _manager.GetConstantInt("BONE_FINGER"));
-
 	switch (bullet)
 	{
 	case NORMAL_BULLET:
 		if (_bulletData._bullletCoolTime[NORMAL_BULLET] == 0) {
 
-			// ʏeˉ炷
-			SoundManager::GetInstance().RingSE(SE_SHOT_NORMAL_BULET);
-
-			// e𐶐
-			_bulletManager->PushBullet(NORMAL_BULLET, _forwardVec, pos, _padNum);
+			// ˉ炵Ēe𐶐
+			Shoot(NORMAL_BULLET, SE_SHOT_NORMAL_BULET);
 
 			// N[^Cݒ肷
 			_bulletData._bullletCoolTime[NORMAL_BULLET] = _manager.GetConstantInt("COOL_TIME_NORMAL");
@@ -777,11 +846,8 @@ void Player::BulletTrigger(int bullet)
 	case GRAPPLER_BULLET:
 		if (_bulletData._bullletCoolTime[GRAPPLER_BULLET] == 0) {
 
-			// ʏeˉ炷
-			SoundManager::GetInstance().RingSE(SE_SHOT_GRAPPLE_BULET);
-
-			// e𐶐
-			_bulletManager->PushBullet(GRAPPLER_BULLET, _forwardVec, pos, _padNum);
+			// ˉ炵Ēe𐶐
+			Shoot(GRAPPLER_BULLET, SE_SHOT_GRAPPLE_BULET);
 
 			// N[^Cݒ肷
 			_bulletData._bullletCoolTime[GRAPPLER_BULLET] = _manager.GetConstantInt("COOL_TIME_GRAPPLER");
@@ -790,11 +856,8 @@ void Player::BulletTrigger(int bullet)
 	case BOMB_BULLET:
 		if (_bulletData._bullletCoolTime[BOMB_BULLET] == 0) {
 
-			// ʏeˉ炷
-			SoundManager::GetInstance().RingSE(SE_SHOT_BOMB_BULET);
-
-			// e𐶐
-			_bulletManager->PushBullet(BOMB_BULLET, _forwardVec, pos, _padNum);
+			// ˉ炵Ēe𐶐
+			Shoot(BOMB_BULLET, SE_SHOT_BOMB_BULET);
 
 			// N[^Cݒ肷
 			_bulletData._bullletCoolTime[BOMB_BULLET] = _manager.GetConstantInt("COOL_TIME_BOMB");
@@ -804,3 +867,29 @@ void Player::BulletTrigger(int bullet)
 		break;
 	}
 }
+
+void Player::Shoot(int bullet, int se)
+{
+	// e̎ނƂ̌{^
+	constexpr int BULLET_INPUT[] = { INPUT_RIGHT_TRIGGER, INPUT_X, INPUT_Y };
+
+	// ͂̒x̌vpɁA{^ƌƌ߂oĂ(AI͑Ȃ)
+	long long inputTime = IsAi() ? -1 : Input::GetInstance().GetPressTime(BULLET_INPUT[bullet], _padNum);
+	long long triggerTime = InputSampler::GetTime();
+
+	// Ɖ̈ʒu͌_̒lg
+	_command.Push([this, bullet, se, pos = Position, forward = _forwardVec, inputTime, triggerTime]() {
+		// ˂W
+		Vec3 shotPos = MV1GetFramePosition(GetModelHandle(), _manager.GetConstantInt("BONE_FINGER"));
+
+		SoundManager::GetInstance().RingSE(se, pos);
+
+		// e̐ƃGtFNg̍ĐA̓͂̋L^ɕt
+		auto& latency = LatencyTracker::GetInstance();
+		latency.SetCurrent(latency.Begin(bullet, _padNum, inputTime, triggerTime));
+
+		_bulletManager->PushBullet(bullet, forward, shotPos, _padNum);
+
+		latency.SetCurrent(-1);
+	});
+}
@@ -2,6 +2,7 @@
 #include "BulletManager.h"
 #include "PlayerManager.h"
 #include "Player.h"
+#include "JobSystem.h"
 
 PlayerBulletCollisionManager::PlayerBulletCollisionManager(std::shared_ptr<BulletManager>& bull, std::shared_ptr<PlayerManager>& pl) :
 	_pBulletManager(bull),
@@ -15,15 +16,39 @@ PlayerBulletCollisionManager::~PlayerBulletCollisionManager()
 
 void PlayerBulletCollisionManager::Update()
 {
+	auto& playerList = _pPlayerManager->GetPlayerList();
+
+	// ԍŕ悤ɒeג
+	_bullet.assign(_pBulletManager->GetBulletList().begin(), _pBulletManager->GetBulletList().end());
+
+	// vC[ƒȇSĂ̑g̔AXbhɕĐɍs
+	// (͌vZȂ̂ŁAɍsĂʂ͕ςȂ)
+	int bulletNum = static_cast<int>(_bullet.size());
+	_hit.assign(playerList.size() * bulletNum, false);
+
+	auto& jobSystem = JobSystem::GetInstance();
+	jobSystem.ParallelFor(static_cast<int>(_hit.size()), jobSystem.GetConstantInt("COLLISION_GRAIN"), [&](int i) {
+		auto& player = playerList[i / bulletNum];
+		auto& bullet = _bullet[i % bulletNum];
+
+		if (bullet->GetPlayerCollisionFlag()) return;
+
+		// s
+		_hit[i] = capsuleSphereCollision(player->_capsuleData.FrontPointA, player->_capsuleData.FrontPointB, player->_capsuleData.Radius, bullet->Position, bullet->GetRadius());
+	});
+
+	// ̏̓GtFNgȂǂôŁACXbhłƂ̏Ԓʂɍs
 	// vC[[v
-	for (auto& player : _pPlayerManager->GetPlayerList()) {
+	for (int p = 0; p < static_cast<int>(playerList.size()); p++) {
+		auto& player = playerList[p];
 		// obg[v
-		for (auto& bullet : _pBulletManager->GetBulletList()) {
+		for (int b = 0; b < bulletNum; b++) {
+			auto& bullet = _bullet[b];
 
+			// ÕvC[ɓďe͓Ȃ
 			if (bullet->GetPlayerCollisionFlag()) continue;
 
-			// s
-			if (capsuleSphereCollision(player->_capsuleData.FrontPointA, player->_capsuleData.FrontPointB, player->_capsuleData.Radius, bullet->Position, bullet->GetRadius())) {
+			if (_hit[p * bulletNum + b]) {
 
 				// ƂvC[ɓ`
 				player->BulletCollision(bullet->GetBulletType());
@@ -33,6 +58,9 @@ void PlayerBulletCollisionManager::Update()
 			}
 		}
 	}
+
+	// ẽt[܂ŎcȂ悤
+	_bullet.clear();
 }
 
 Vec3 PlayerBulletCollisionManager::closestPointOnSegment( Vec3& A, Vec3& B, Vec3& P)
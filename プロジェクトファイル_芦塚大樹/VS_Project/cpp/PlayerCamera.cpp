@@ -1,6 +1,7 @@
 #include "PlayerCamera.h"
 #include "DxLib.h"
 #include "Input.h"
+#include "FixedTimestep.h"
 
 PlayerCamera::PlayerCamera(Vec3 pos, int padNum, Vec3 forward):
 	_lightHandle(0),
@@ -28,6 +29,10 @@ PlayerCamera::~PlayerCamera()
 
 void PlayerCamera::Update(Vec3 pos,Vec3 forward, Vec3 angle)
 {
+	// `ŕԂ邽߂ɑÕeBbN̍Wc
+	_prevPosition = Position;
+	_prevTarget = _target;
+
 	// ^[Qbg̐ݒ
 	//_target = Vec3(pos.x, pos.y + GetConstantFloat("CAMERA_MARGIN_Y"), pos.z);
 	
@@ -41,6 +46,13 @@ void PlayerCamera::Update(Vec3 pos,Vec3 forward, Vec3 angle)
 	//Position = Rotate(Position,forward);
 
 
+	// ߂Ă̍XVł͑O̍WȂ̂œɂ
+	if (!_isUpdated) {
+		_prevPosition = Position;
+		_prevTarget = _target;
+		_isUpdated = true;
+	}
+
 	// Cg̊pxݒ
 	SetLightDirectionHandle(_lightHandle, (_target - Position).VGet());
 }
@@ -50,6 +62,22 @@ Vec3 PlayerCamera::GetTarget()
 	return _target;
 }
 
+Vec3 PlayerCamera::GetDrawPosition() const
+{
+	return FixedTimestep::GetInstance().Interpolate(_prevPosition, Position);
+}
+
+Vec3 PlayerCamera::GetDrawTarget() const
+{
+	return FixedTimestep::GetInstance().Interpolate(_prevTarget, _target);
+}
+
+void PlayerCamera::Reset()
+{
+	Angle = Vec3{};
+	_isUpdated = false;
+}
+
 Vec3 PlayerCamera::Rotate(Vec3 pos, Vec3 forward)
 {
 	// Cvbg̃CX^X擾
@@ -4,12 +4,15 @@
 #include "CollisionManager.h"
 #include "Player.h"
 #include "PlayerUi.h"
+#include "ModelManager.h"
 #include <cassert>
 #include "MyEffect.h"
 #include "EffectManager.h"
 #include "Effekseer.h"
 #include "SoundManager.h"
 #include "Application.h"
+#include "JobSystem.h"
+#include "Input.h"
 
 PlayerManager::PlayerManager(std::shared_ptr<StageManager>& stageManager, std::shared_ptr<BulletManager>& bullet, PlayerData& data) :
 	_playerData(data),
@@ -20,51 +23,10 @@ PlayerManager::PlayerManager(std::shared_ptr<StageManager>& stageManager, std::s
 	// Ot@C萔擾
 	ReadCSV("data/constant/Player.csv");
 
-	// f̃[h
-	_modelHandle[0] = MV1LoadModel("data/model/Player11.mv1");
-	_modelHandle[1] = MV1LoadModel("data/model/Player2.mv1");
-	_modelHandle[2] = MV1LoadModel("data/model/Player3.mv1");
-	_modelHandle[3] = MV1LoadModel("data/model/Player4.mv1");
-
 	// eCX^X̍쐬
 	{
-		// eCX^X̍쐬
-		if (_playerData.playerNum < GetConstantInt("MAX_NUM")) {
-
-				// vC[CX^X̍쐬
-				for (int num = 0; num <= _playerData.playerNum; num++) {
-					if (num < 0 || num >= GetConstantInt("MAX_NUM")) {
-						assert(false);
-					}
-					_pPlayer.push_back(std::make_shared<Player>(bullet, *this, num, _bulletData[num]));
-
-					switch (num)
-					{
-					case 0:
-						_pPlayer[num]->Position = Vec3{ 0.0f,0.0f,0.0f };
-						_pPlayer[num]->Angle.y = DX_PI_F / -4;
-						break;
-					case 1:
-						_pPlayer[num]->Position = Vec3{ GetConstantFloat("PLAYER_POS"),0.0f, GetConstantFloat("PLAYER_POS") };
-						_pPlayer[num]->Angle.y = DX_PI_F / -4 * 5;
-						break;
-					case 2:
-						_pPlayer[num]->Position = Vec3{ 0.0f,0.0f, GetConstantFloat("PLAYER_POS") };
-						_pPlayer[num]->Angle.y = DX_PI_F / -4 * 3;
-						break;
-					case 3:
-						_pPlayer[num]->Position = Vec3{ GetConstantFloat("PLAYER_POS"),0.0f,0.0f };
-						_pPlayer[num]->Angle.y = DX_PI_F / -4 * 7;
-						break;
-					default:
-						break;
-					}
-				}
-			//}
-		}
-		else {
-			assert(false); // assert(true) ͏ɐ^Ȃ̂ŁAassert(false) ɕύX
-		}
+		// vC[CX^X̍쐬
+		CreatePlayer();
 
 
 		// RW}l[W[̍쐬
@@ -87,26 +49,49 @@ PlayerManager::PlayerManager(std::shared_ptr<StageManager>& stageManager, std::s
 
 PlayerManager::~PlayerManager()
 {
-	// f̃f[g
-	for (int num = 0; num < GetConstantInt("MAX_NUM"); num++) {
-		MV1DeleteModel(_modelHandle[num]);
-	}
 }
 
 void PlayerManager::Update()
 {
+	auto& jobSystem = JobSystem::GetInstance();
+	int playerNum = static_cast<int>(_pPlayer.size());
+
+	// vC[𓮂ĂԂ́A}EXŎ_𓮂
+	Input::GetInstance().CaptureMouse();
+
+	// 擪ÃvC[ȂvC[̐Xbhɕ
+	// (AI0Ԃ̃vC[̈ړ̍WƗĝŁAォ珇Ԃɍs)
+	// vC[DxLibEGtFNgETEhEe̐͗߂ĂAvC[̏ԂɍŝŁA
+	// ԂɍsƂƌʂ͕ςȂ
+	int parallelNum = 0;
+	if (GetConstatBool("PARALLEL_UPDATE") && Application::GetInstance().IsParallelUpdate()) {
+		while (parallelNum < playerNum && !_pPlayer[parallelNum]->IsAi()) {
+			parallelNum++;
+		}
+	}
+
 	// vC[̈ړȂ
-	for (auto& pl : _pPlayer) {
-		if(!pl->GetDeadFlag()) pl->Control();
+	jobSystem.ParallelFor(parallelNum, 1, [this](int i) {
+		_pPlayer[i]->BeginDefer();
+		if (!_pPlayer[i]->GetDeadFlag()) _pPlayer[i]->Control();
+	});
+	for (int i = 0; i < playerNum; i++) {
+		auto& pl = _pPlayer[i];
+		if (i < parallelNum) {
+			pl->ExecuteDeferred();
+		}
+		else if (!pl->GetDeadFlag()) {
+			pl->Control();
+		}
 	}
 
 	if (_winner != -1) {
 		_frame++;
 		if (_frame >= 30) {
-			_pWinEffect->StopEffect();
+			_winEffect.StopEffect();
 		}
 
-		_pWinEffect->Update(_pPlayer[_winner]->Position);
+		_winEffect.Update(_pPlayer[_winner]->Position);
 	}
 
 	ColResult result = _pCollision->PlayerCollision(_pPlayer);
@@ -117,19 +102,34 @@ void PlayerManager::Update()
 	}
 
 	// vC[̍XV
-	for (auto& pl : _pPlayer) {
+	jobSystem.ParallelFor(parallelNum, 1, [this](int i) {
+		_pPlayer[i]->BeginDefer();
+		_pPlayer[i]->Update();
+	});
+	for (int i = 0; i < playerNum; i++) {
+		auto& pl = _pPlayer[i];
 
 		// XV
-		pl->Update();
+		if (i < parallelNum) {
+			pl->ExecuteDeferred();
+		}
+		else {
+			pl->Update();
+		}
 
 		// 
 		if (pl->Position.y <= GetConstantFloat("DEAD_LINE") && !pl->GetDeadFlag()) {
 			pl->KillPlayer();
-			_pShotOutEffect = std::make_shared<MyEffect>(SHOT_DOWN_EFFECT, pl->Position);
-			_pShotOutEffect->Update(pl->Position);
+			_shotOutEffect = MyEffect(SHOT_DOWN_EFFECT, pl->Position);
+			_shotOutEffect.Update(pl->Position);
 			SoundManager::GetInstance().RingSE(SE_KO);
 
 		}
+
+		// ĂvC[̈ʒuŉ𕷂
+		if (!pl->GetDeadFlag()) {
+			SoundManager::GetInstance().AddListener(pl->Position);
+		}
 	}
 
 	// UI̍XV
@@ -139,13 +139,23 @@ void PlayerManager::Update()
 void PlayerManager::Draw(int num) const
 {
 	// vC[̕`
+	DrawPlayer();
+
+	// UI̕`
+	DrawUi(num, 0, 0);
+}
+
+void PlayerManager::DrawPlayer() const
+{
 	for (auto& pl : _pPlayer) {
 		pl->Draw();
 	}
+}
 
-	// UI̕`
-	_pUi->Draw(Vec2{_cameraSenter.a,_cameraSenter.b}, _bulletData[num]);
-
+void PlayerManager::DrawUi(int num, int x, int y) const
+{
+	// ʂ̒ŚAʂ̍ォ̍W
+	_pUi->Draw(Vec2{ _cameraSenter.a + x,_cameraSenter.b + y }, _bulletData[num], num);
 }
 
 VECTOR4 PlayerManager::GetArea(int num) const
@@ -165,8 +175,16 @@ int PlayerManager::GetPlayerNum() const
 
 int PlayerManager::GetModelHandle(int num) const
 {
+	// LN^[Ƃ̃f̃pX
+	constexpr const char* MODEL_PATH[4] = {
+		"data/model/Player11.mv1",
+		"data/model/Player2.mv1",
+		"data/model/Player3.mv1",
+		"data/model/Player4.mv1",
+	};
+
 	// vC[io[ɑΉfnhԂ
-	return MV1DuplicateModel(_modelHandle[_playerData.character[num]]);
+	return ModelManager::GetInstance().Duplicate(MODEL_PATH[_playerData.character[num]]);
 }
 
 void PlayerManager::CameraSet(int num) const
@@ -197,16 +215,16 @@ void PlayerManager::SetWinner()
 		if (_pPlayer[PLAYER_ONE]->GetDeadFlag()) {
 			_playerData.winner = _playerData.character[_pPlayer[PLAYER_TWO]->GetPlayerNum()];
 
-			_pWinEffect = std::make_shared<MyEffect>(WIN_EFFECT, _pPlayer[PLAYER_TWO]->Position);
-			_pWinEffect->Update(_pPlayer[PLAYER_TWO]->Position);
+			_winEffect = MyEffect(WIN_EFFECT, _pPlayer[PLAYER_TWO]->Position);
+			_winEffect.Update(_pPlayer[PLAYER_TWO]->Position);
 
 			_winner = PLAYER_TWO;
 		}
 		else {
 			_playerData.winner = _playerData.character[_pPlayer[PLAYER_ONE]->GetPlayerNum()];
 
-			_pWinEffect = std::make_shared<MyEffect>(WIN_EFFECT, _pPlayer[PLAYER_ONE]->Position);
-			_pWinEffect->Update(_pPlayer[PLAYER_ONE]->Position);
+			_winEffect = MyEffect(WIN_EFFECT, _pPlayer[PLAYER_ONE]->Position);
+			_winEffect.Update(_pPlayer[PLAYER_ONE]->Position);
 
 			_winner = PLAYER_ONE;
 		}
@@ -217,8 +235,8 @@ void PlayerManager::SetWinner()
 				_playerData.winner = _playerData.character[pl->GetPlayerNum()];
 
 				// GtFNgCX^X̍쐬
-				_pWinEffect = std::make_shared<MyEffect>(WIN_EFFECT, _pPlayer[pl->GetPlayerNum()]->Position);
-				_pWinEffect->Update(_pPlayer[pl->GetPlayerNum()]->Position);
+				_winEffect = MyEffect(WIN_EFFECT, _pPlayer[pl->GetPlayerNum()]->Position);
+				_winEffect.Update(_pPlayer[pl->GetPlayerNum()]->Position);
 
 				_winner = pl->GetPlayerNum();
 				return;
@@ -233,8 +251,7 @@ void PlayerManager::AddAi()
 	_playerData.playerNum++;
 	_playerData.character[1] = rand() % 3;
 	_pPlayer.push_back(std::make_shared<Player>(_bulletManager, *this, _bulletData[_playerData.playerNum]));
-	_pPlayer[_playerData.playerNum]->Position = Vec3{ GetConstantFloat("PLAYER_POS"),0.0f, GetConstantFloat("PLAYER_POS") };
-	_pPlayer[_playerData.playerNum]->Angle.y = DX_PI_F / -4 * 5;
+	PlaceStart(_playerData.playerNum);
 }
 
 Vec3 PlayerManager::GetPlayerPos() const
@@ -337,3 +354,69 @@ VECTOR2 PlayerManager::CreateScreenCenter(int num)
 		break;
 	}
 }
+
+void PlayerManager::Reset()
+{
+	// GtFNg~߂
+	_winEffect.StopEffect();
+	_winEffect = MyEffect();
+	_shotOutEffect = MyEffect();
+
+	// vC[͍蒼ɁAԂƏʒu߂(AI͂1Ԃ̈ʒu)
+	for (int num = 0; num < static_cast<int>(_pPlayer.size()); num++) {
+		_pPlayer[num]->Reset();
+		PlaceStart(num);
+	}
+
+	// UĨAj[VƋL^߂ɂ
+	_pUi->Reset();
+
+	// ҂̏
+	_playerData.winner = -1;
+	_winner = -1;
+	_frame = 0;
+}
+
+void PlayerManager::CreatePlayer()
+{
+	// eCX^X̍쐬
+	if (_playerData.playerNum < GetConstantInt("MAX_NUM")) {
+
+		// vC[CX^X̍쐬
+		for (int num = 0; num <= _playerData.playerNum; num++) {
+			if (num < 0 || num >= GetConstantInt("MAX_NUM")) {
+				assert(false);
+			}
+			_pPlayer.push_back(std::make_shared<Player>(_bulletManager, *this, num, _bulletData[num]));
+			PlaceStart(num);
+		}
+	}
+	else {
+		assert(false); // assert(true) ͏ɐ^Ȃ̂ŁAassert(false) ɕύX
+	}
+}
+
+void PlayerManager::PlaceStart(int num)
+{
+	switch (num)
+	{
+	case 0:
+		_pPlayer[num]->Position = Vec3{ 0.0f,0.0f,0.0f };
+		_pPlayer[num]->Angle.y = DX_PI_F / -4;
+		break;
+	case 1:
+		_pPlayer[num]->Position = Vec3{ GetConstantFloat("PLAYER_POS"),0.0f, GetConstantFloat("PLAYER_POS") };
+		_pPlayer[num]->Angle.y = DX_PI_F / -4 * 5;
+		break;
+	case 2:
+		_pPlayer[num]->Position = Vec3{ 0.0f,0.0f, GetConstantFloat("PLAYER_POS") };
+		_pPlayer[num]->Angle.y = DX_PI_F / -4 * 3;
+		break;
+	case 3:
+		_pPlayer[num]->Position = Vec3{ GetConstantFloat("PLAYER_POS"),0.0f,0.0f };
+		_pPlayer[num]->Angle.y = DX_PI_F / -4 * 7;
+		break;
+	default:
+		break;
+	}
+}
@@ -2,16 +2,17 @@
 #include "DxLib.h"
 #include "PlayerManager.h"
 #include <cmath>
+#include "AtlasManager.h"
 
 
 PlayerUi::PlayerUi(int playerNum):
 	_frame(0.0f)
 {
 	// 摜̃[h
-	_normalBulletHandle = LoadGraph("data/image/Icon_Bullet.png");
-	_bombBulletHandle = LoadGraph("data/image/Icon_Bomb.png");
-	_grappleBulletHandle = LoadGraph("data/image/Icon_Anchor.png");
-	_reticleHandle = LoadGraph("data/image/circle.png");
+	_normalBulletHandle = AtlasManager::GetInstance().LoadGraph("data/image/Icon_Bullet.png");
+	_bombBulletHandle = AtlasManager::GetInstance().LoadGraph("data/image/Icon_Bomb.png");
+	_grappleBulletHandle = AtlasManager::GetInstance().LoadGraph("data/image/Icon_Anchor.png");
+	_reticleHandle = AtlasManager::GetInstance().LoadGraph("data/image/circle.png");
 
 	// vC[̑ōWg嗦ύX
 	switch (playerNum)
@@ -44,10 +45,10 @@ PlayerUi::PlayerUi(int playerNum):
 
 PlayerUi::~PlayerUi()
 {
-	DeleteGraph(_normalBulletHandle);
-	DeleteGraph(_bombBulletHandle);
-	DeleteGraph(_grappleBulletHandle);
-	DeleteGraph(_reticleHandle);
+	AtlasManager::GetInstance().DeleteGraph(_normalBulletHandle);
+	AtlasManager::GetInstance().DeleteGraph(_bombBulletHandle);
+	AtlasManager::GetInstance().DeleteGraph(_grappleBulletHandle);
+	AtlasManager::GetInstance().DeleteGraph(_reticleHandle);
 }
 
 void PlayerUi::Update()
@@ -56,8 +57,40 @@ void PlayerUi::Update()
 	_exRate = 0.2 +  0.04 * sin(_frame); // yWiU50̃TCgj
 }
 
-void PlayerUi::Draw(Vec2 center, BulletData data) const
+void PlayerUi::Reset()
 {
+	_frame = 0.0f;
+	_exRate = 0.2;
+	_record.clear();
+}
+
+void PlayerUi::Draw(Vec2 center, BulletData data, int viewNum) const
+{
+	// ʂ̐L^pӂ
+	if (static_cast<int>(_record.size()) <= viewNum) {
+		_record.resize(viewNum + 1);
+	}
+
+	auto& record = _record[viewNum];
+
+	// SWN[^CςƂL^
+	bool isChanged = !record.isValid || record.center.x != center.x || record.center.y != center.y;
+	for (int i = 0; i < 3; i++) {
+		isChanged |= record.coolTime[i] != data._bullletCoolTime[i];
+	}
+
+	if (isChanged) {
+		RecordUi(record, center, data);
+	}
+
+	// L^UI܂Ƃ߂ĕ`
+	record.batch.Draw();
+}
+
+void PlayerUi::RecordUi(Record& record, Vec2 center, const BulletData& data) const
+{
+	auto& batch = record.batch;
+	batch.Clear();
 
 	// \W
 	int x, y;
@@ -66,33 +99,38 @@ void PlayerUi::Draw(Vec2 center, BulletData data) const
 	y = center.intY() + _drawMargin.intY();
 
 	// ACR̕`
-	DrawRotaGraph(x, y, 0.2f, 0.0, _normalBulletHandle, true);
-	DrawRotaGraph(x + _margin, y, 0.2f, 0.0, _grappleBulletHandle, true);
-	DrawRotaGraph(x + _margin * 2, y, 0.2f, 0.0, _bombBulletHandle, true);
+	batch.AddRotaGraph(x, y, 0.2f, 0.0, _normalBulletHandle);
+	batch.AddRotaGraph(x + _margin, y, 0.2f, 0.0, _grappleBulletHandle);
+	batch.AddRotaGraph(x + _margin * 2, y, 0.2f, 0.0, _bombBulletHandle);
 
-	// N[^Clp`ŕ`
+	// N[^Clp`ŕ`(ACȐɏd˂)
 	double margin = 0;
-	SetDrawBlendMode(DX_BLENDMODE_ALPHA, 150);
 	if (data._bullletCoolTime[NORMAL_BULLET] != 0) {
 		auto rate = static_cast<float>(data._bullletCoolTime[NORMAL_BULLET] / 30.0f);
 		margin = 100 * rate ;
-		DrawBox(x - 50, y + 50 - static_cast<int>(margin), x + 50, y + 50, 0xd30707, true);
+		batch.AddBox(x - 50, y + 50 - static_cast<int>(margin), x + 50, y + 50, 0xd30707, 1, DX_BLENDMODE_ALPHA, 150);
 	}
 
 	if (data._bullletCoolTime[GRAPPLER_BULLET] != 0) {
 		auto rate = static_cast<float>(data._bullletCoolTime[GRAPPLER_BULLET] / 300.0f);
 		margin = 100 * rate;
-		DrawBox(x - 50 + _margin, y + 50 - static_cast<int>(margin), x + 50 + _margin, y + 50, 0xd30707, true);
+		batch.AddBox(x - 50 + _margin, y + 50 - static_cast<int>(margin), x + 50 + _margin, y + 50, 0xd30707, 1, DX_BLENDMODE_ALPHA, 150);
 	}
 
 	if (data._bullletCoolTime[BOMB_BULLET] != 0) {
 
 		auto rate = static_cast<float>(data._bullletCoolTime[BOMB_BULLET] / 300.0f);
 		margin = 100 * rate;
-		DrawBox(x - 50 + _margin * 2, y + 50 - static_cast<int>(margin), x + 50 + _margin * 2, y + 50, 0xd30707, true);
+		batch.AddBox(x - 50 + _margin * 2, y + 50 - static_cast<int>(margin), x + 50 + _margin * 2, y + 50, 0xd30707, 1, DX_BLENDMODE_ALPHA, 150);
 	}
-	SetDrawBlendMode(DX_BLENDMODE_NOBLEND, 0);
 
 	//eBN̕`
-	DrawRotaGraph(center.intX(), center.intY(), 1.0, 0.0, _reticleHandle, true);
+	batch.AddRotaGraph(center.intX(), center.intY(), 1.0, 0.0, _reticleHandle, 2);
+
+	// L^Ƃ̒loĂ
+	record.center = center;
+	for (int i = 0; i < 3; i++) {
+		record.coolTime[i] = data._bullletCoolTime[i];
+	}
+	record.isValid = true;
 }
\ No newline at end of file
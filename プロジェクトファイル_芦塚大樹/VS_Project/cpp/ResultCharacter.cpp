@@ -1,5 +1,6 @@
 #include "ResultCharacter.h"
 #include "DxLib.h"
+#include "ModelManager.h"
 
 ResultCharacter::ResultCharacter(int plNum)
 {
@@ -13,7 +14,7 @@ ResultCharacter::ResultCharacter(int plNum)
 		Angle = Vec3{ 0.0f,-1.5f,0.0f };	// px
 
 		// f̏
-		InitModel(MV1LoadModel("data/model/ResultCharacter1.mv1"));
+		InitModel(ModelManager::GetInstance().Duplicate("data/model/ResultCharacter1.mv1"));
 
 		// Aj[V̏
 		InitAnimation(_modelHandle, 5, 0.1f);
@@ -30,7 +31,7 @@ ResultCharacter::ResultCharacter(int plNum)
 		Angle = Vec3{ 0.0f,-1.5f,0.0f };	// px
 
 		// f̏
-		InitModel(MV1LoadModel("data/model/ResultCharacter2.mv1"));
+		InitModel(ModelManager::GetInstance().Duplicate("data/model/ResultCharacter2.mv1"));
 
 		// Aj[V̏
 		InitAnimation(_modelHandle, 0, 0.1f);
@@ -46,7 +47,7 @@ ResultCharacter::ResultCharacter(int plNum)
 		Angle = Vec3{ 0.0f,-1.5f,0.0f };	// px
 
 		// f̏
-		InitModel(MV1LoadModel("data/model/ResultCharacter3.mv1"));
+		InitModel(ModelManager::GetInstance().Duplicate("data/model/ResultCharacter3.mv1"));
 
 		// Aj[V̏
 		InitAnimation(_modelHandle, 5, 0.1f);
@@ -62,7 +63,7 @@ ResultCharacter::ResultCharacter(int plNum)
 		Angle = Vec3{ 0.0f,-1.5f,0.0f };	// px
 
 		// f̏
-		InitModel(MV1LoadModel("data/model/ResultCharacter4.mv1"));
+		InitModel(ModelManager::GetInstance().Duplicate("data/model/ResultCharacter4.mv1"));
 
 		// Aj[V̏
 		InitAnimation(_modelHandle, 5, 0.1f);
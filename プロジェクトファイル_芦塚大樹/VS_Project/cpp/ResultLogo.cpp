@@ -1,14 +1,15 @@
 #include "ResultLogo.h"
 #include "DxLib.h"
+#include "AtlasManager.h"
 
 ResultLogo::ResultLogo()
 {
-	_logoHandle = LoadGraph("data/image/Winner.png");
+	_logoHandle = AtlasManager::GetInstance().LoadGraph("data/image/Winner.png");
 }
 
 ResultLogo::~ResultLogo()
 {
-	DeleteGraph(_logoHandle);
+	AtlasManager::GetInstance().DeleteGraph(_logoHandle);
 }
 
 void ResultLogo::Draw() const
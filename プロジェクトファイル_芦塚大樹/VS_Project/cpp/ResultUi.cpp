@@ -1,40 +1,65 @@
 #include "ResultUi.h"
 #include "DxLib.h"
+#include "AtlasManager.h"
 
 ResultUi::ResultUi(int time)
 {
 	// e摜̃[h
-	_resultLogoHandle = LoadGraph("data/image/Winner.png");
-	_redLineHandle = LoadGraph("data/image/RedLine.png");
-	_timeStringHandle = LoadGraph("data/image/TimeString.png");
-	_rankFrame = LoadGraph("data/image/RankFrame.png");
-	_guide = LoadGraph("data/image/Guide.png");
+	_resultLogoHandle = AtlasManager::GetInstance().LoadGraph("data/image/Winner.png");
+	_redLineHandle = AtlasManager::GetInstance().LoadGraph("data/image/RedLine.png");
+	_timeStringHandle = AtlasManager::GetInstance().LoadGraph("data/image/TimeString.png");
+	_rankFrame = AtlasManager::GetInstance().LoadGraph("data/image/RankFrame.png");
+	_guide = AtlasManager::GetInstance().LoadGraph("data/image/Guide.png");
 
 	// Ԃɂă[h摜ύX
 	if (time <= 1800) {
-		_rankHandle = LoadGraph("data/image/RankS.png");	// SN
+		_rankHandle = AtlasManager::GetInstance().LoadGraph("data/image/RankS.png");	// SN
 	}
 	else if (time <= 3600) {
-		_rankHandle = LoadGraph("data/image/RankA.png");	// AN
+		_rankHandle = AtlasManager::GetInstance().LoadGraph("data/image/RankA.png");	// AN
 	}
 	else if(time <= 7200) {
-		_rankHandle = LoadGraph("data/image/RankB.png");	// BN
+		_rankHandle = AtlasManager::GetInstance().LoadGraph("data/image/RankB.png");	// BN
 	}
 	else {
-		_rankHandle = LoadGraph("data/image/RankC.png");	// CN
+		_rankHandle = AtlasManager::GetInstance().LoadGraph("data/image/RankC.png");	// CN
 	}
 
+	// \͕ςȂ̂ňxL^
+	{
+		// Ԑ
+		_batch.AddGraph(0, 430, _redLineHandle, 0);
+
+		// UgS
+		_batch.AddGraph(144, 568, _resultLogoHandle, 1);
+
+		// Ng
+		_batch.AddGraph(1045, 430, _rankFrame, 1);
+
+		// j^C
+		_batch.AddGraph(62, 156, _timeStringHandle, 1);
+
+		// N̉摜
+		_batch.AddGraph(1459, 537, _rankHandle, 2);
+
+		// ʘg(̘gA̘g)
+		_batch.AddBox(0, 990, 1920, 1080, 0x000000, 2);
+		_batch.AddBox(0, 0, 1920, 90, 0x000000, 2);
+
+		// {^
+		_batch.AddGraph(900, 990, _guide, 3);
+	}
 }
 
 ResultUi::~ResultUi()
 {
 	// 摜̃f[g
-	DeleteGraph(_resultLogoHandle);
-	DeleteGraph(_redLineHandle);
-	DeleteGraph(_timeStringHandle);
-	DeleteGraph(_rankFrame);
-	DeleteGraph(_rankHandle);
-	DeleteGraph(_guide);
+	AtlasManager::GetInstance().DeleteGraph(_resultLogoHandle);
+	AtlasManager::GetInstance().DeleteGraph(_redLineHandle);
+	AtlasManager::GetInstance().DeleteGraph(_timeStringHandle);
+	AtlasManager::GetInstance().DeleteGraph(_rankFrame);
+	AtlasManager::GetInstance().DeleteGraph(_rankHandle);
+	AtlasManager::GetInstance().DeleteGraph(_guide);
 }
 
 void ResultUi::Update()
@@ -43,28 +68,6 @@ void ResultUi::Update()
 
 void ResultUi::Draw() const
 {
-	// Ԑ̕`
-	DrawGraph(0, 430, _redLineHandle, true);
-
-	// UgS̕`
-	DrawGraph(144, 568, _resultLogoHandle, true);
-	
-	// Ng̕`
-	DrawGraph(1045, 430, _rankFrame, true);
-
-	// j^C̕`
-	DrawGraph(62, 156, _timeStringHandle, true);
-
-	// N̉摜̕`
-	DrawGraph(1459, 537, _rankHandle, true);
-
-	// ʘg̕`
-	// ̘g
-	DrawBox(0, 990, 1920, 1080, 0x000000, true);
-
-	// ̘g
-	DrawBox(0, 0, 1920, 90, 0x000000, true);
-	
-	// {^̕`
-	DrawGraph(900, 990, _guide, true);
+	// L^UI܂Ƃ߂ĕ`
+	_batch.Draw();
 }
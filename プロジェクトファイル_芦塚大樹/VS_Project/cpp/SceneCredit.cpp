@@ -6,6 +6,8 @@
 #include "SceneManager.h"
 #include "Input.h"
 #include "Application.h"
+#include "AtlasManager.h"
+#include "AssetLoader.h"
 
 SceneCredit::SceneCredit() :
 	_frame(Application::GetInstance().GetConstantInt("FRAME_NUM")),
@@ -26,7 +28,7 @@ SceneCredit::SceneCredit() :
 	_pChar4 = std::make_shared<CreditCharacter>(3);
 
 	// NWbg摜̃[h
-	_creditHandle = LoadGraph("data/image/Credit.png");
+	_creditHandle = AtlasManager::GetInstance().LoadGraph("data/image/Credit.png");
 
 	// BGM̕ύX
 	SoundManager::GetInstance().StopBGM(BGM_OPENING);
@@ -35,7 +37,7 @@ SceneCredit::SceneCredit() :
 
 SceneCredit::~SceneCredit()
 {
-	DeleteGraph(_creditHandle);
+	AtlasManager::GetInstance().DeleteGraph(_creditHandle);
 }
 
 void SceneCredit::Update()
@@ -54,6 +56,9 @@ void SceneCredit::NormalUpdate()
 	for (int num = 0; num < Input::GetInstance().GetPadNum(); num++) {
 		if (Input::GetInstance().IsTrigger(INPUT_B, num)) {
 
+			// tF[hAEg̊ԂɃ^Cg̃AZbgǂݍł
+			AssetLoader::GetInstance().Request("data/manifest/SceneTitle.csv");
+
 			// tF[hAEgɈڍs
 			_updateFunc = &SceneCredit::FadeOutUpdate;
 			_drawFunc = &SceneCredit::FadeDraw;
@@ -76,6 +81,9 @@ void SceneCredit::NormalUpdate()
 		SoundManager::GetInstance().StopBGM(BGM_THEME);
 		SoundManager::GetInstance().StartBGM(BGM_OPENING);
 
+		// tF[hAEg̊ԂɃ^Cg̃AZbgǂݍł
+		AssetLoader::GetInstance().Request("data/manifest/SceneTitle.csv");
+
 		// tF[hAEgɈڍs
 		_updateFunc = &SceneCredit::FadeOutUpdate;
 		_drawFunc = &SceneCredit::FadeDraw;
@@ -3,6 +3,24 @@
 #include "Application.h"
 #include "Input.h"
 #include "SceneMenu.h"
+#include "DxLib.h"
+#include "ModelManager.h"
+#include "AtlasManager.h"
+
+SceneManager::~SceneManager()
+{
+	// DxLib_EnďɌĂ΂̂ŁAłDxLibĂ΂Ȃ
+	// (Î~Terminateō폜Ă)
+}
+
+void SceneManager::Terminate()
+{
+	if (_backdropHandle != -1) {
+		DeleteGraph(_backdropHandle);
+		_backdropHandle = -1;
+	}
+	_isBackdropValid = false;
+}
 
 void SceneManager::ChangeScene(std::shared_ptr<SceneBase> next)
 {
@@ -13,6 +31,14 @@ void SceneManager::ChangeScene(std::shared_ptr<SceneBase> next)
 	else {
 		_pScene.back() = next;	// ̂̂ւ
 	}
+
+	// ÕV[gĂfƁAǂ݂gȂ摜
+	ModelManager::GetInstance().ReleaseUnused();
+	AtlasManager::GetInstance().DeleteUnusedPreload();
+
+#ifdef _DEBUG
+	ModelManager::GetInstance().Report();
+#endif
 }
 
 void SceneManager::SceneUpdate()
@@ -23,15 +49,47 @@ void SceneManager::SceneUpdate()
 
 void SceneManager::SceneDraw() const
 {
-	// ̂ݕ`
-	for (auto& scene : _pScene) {
-		scene->Draw();
+	// ǉ̃V[Ȃ΂̂܂ܕ`
+	if (_pScene.size() == 1) {
+		_pScene.back()->Draw();
+		return;
 	}
+
+	// ̃V[͍XVȂ̂ŁAx`悵ĉʂÎ~ƂĎĂ
+	if (!_isBackdropValid) {
+		auto& app = Application::GetInstance();
+		int width = app.GetConstantInt("SCREEN_WIDTH");
+		int height = app.GetConstantInt("SCREEN_HEIGHT");
+
+		// ȊO`
+		for (auto it = _pScene.begin(); it != std::prev(_pScene.end()); it++) {
+			(*it)->Draw();
+		}
+
+		// `挋ʂ荞(O̐Î~͍폜Ă蒼)
+		if (_backdropHandle != -1) {
+			DeleteGraph(_backdropHandle);
+		}
+		_backdropHandle = MakeGraph(width, height);
+		GetDrawScreenGraph(0, 0, width, height, _backdropHandle);
+
+		_isBackdropValid = true;
+	}
+	else {
+		// ĂÎ~`
+		DrawGraph(0, 0, _backdropHandle, false);
+	}
+
+	// `
+	_pScene.back()->Draw();
 }
 
 void SceneManager::PushScene(std::shared_ptr<SceneBase> surface)
 {
 	_pScene.push_back(surface);
+
+	// ̃V[ς̂ŐÎ~蒼
+	_isBackdropValid = false;
 }
 
 void SceneManager::PopScene()
@@ -39,6 +97,9 @@ void SceneManager::PopScene()
 	// V[z2ȏ̗vfĂΈԏ̗vf菜
 	if (_pScene.size() > 1) {
 		_pScene.pop_back();
+
+		// ̃V[ς̂ŐÎ~蒼
+		_isBackdropValid = false;
 	}
 }
 
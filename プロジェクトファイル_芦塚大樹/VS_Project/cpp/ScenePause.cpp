@@ -5,6 +5,8 @@
 #include "ScenePvp.h"
 #include "Input.h"
 #include "Application.h"
+#include "AtlasManager.h"
+#include "AssetLoader.h"
 
 ScenePause::ScenePause(PlayerData data) :
 	_data(data),
@@ -15,8 +17,8 @@ ScenePause::ScenePause(PlayerData data) :
 	ReadCSV("data/constant/ScenePause.csv");
 
 	// 摜̃[h
-	_graphHandle = LoadGraph("data/image/Pause.png");
-	_textImageHandle = LoadGraph("data/image/PressAnyButton.png");
+	_graphHandle = AtlasManager::GetInstance().LoadGraph("data/image/Pause.png");
+	_textImageHandle = AtlasManager::GetInstance().LoadGraph("data/image/PressAnyButton.png");
 
 	_updateFunc = &ScenePause::FadeInUpdate;
 	_drawFunc = &ScenePause::FadeDraw;
@@ -24,8 +26,8 @@ ScenePause::ScenePause(PlayerData data) :
 
 ScenePause::~ScenePause()
 {
-	DeleteGraph(_graphHandle);
-	DeleteGraph(_textImageHandle);
+	AtlasManager::GetInstance().DeleteGraph(_graphHandle);
+	AtlasManager::GetInstance().DeleteGraph(_textImageHandle);
 }
 
 void ScenePause::Update()
@@ -42,6 +44,15 @@ void ScenePause::NormalUpdate()
 {
 	for (int num = 0; num <= _data.playerNum; num++) {
 		if (Input::GetInstance().IsTrigger(INPUT_A, num)) {
+
+			// tF[hAEg̊ԂɑΐV[̃AZbgǂݍł
+			if (_data.playerNum == PLAYER_ONE) {
+				AssetLoader::GetInstance().Request("data/manifest/ScenePve.csv");
+			}
+			else {
+				AssetLoader::GetInstance().Request("data/manifest/ScenePvp.csv");
+			}
+
 			_updateFunc = &ScenePause::FadeOutUpdate;
 			_drawFunc = &ScenePause::FadeDraw;
 		}
@@ -18,6 +18,7 @@
 #include "EffectManager.h"
 #include "PlayerBulletCollisionManager.h"
 #include "ItemManager.h"
+#include "AssetLoader.h"
 
 ScenePve::ScenePve(PlayerData data) :
 	_frame(Application::GetInstance().GetConstantInt("FRAME_NUM") * 2)
@@ -70,6 +71,10 @@ ScenePve::ScenePve(PlayerData data) :
 		_drawFunc = &ScenePve::FadeInDraw;
 	}
 
+	// ̗ƁAXNvgœpbh̓͂߂ɂ
+	srand(Application::GetInstance().GetMatchSeed());
+	Input::GetInstance().RestartDevices();
+
 	// vC[̍XV
 	_pPlayerManager->Update();
 }
@@ -94,6 +99,31 @@ void ScenePve::Draw() const
 	(this->*_drawFunc)();
 }
 
+void ScenePve::Reset()
+{
+	// ɕς̂Jn̏Ԃɖ߂(蒼Ɏg)
+	_pStage->ResetStage();
+	_pBulletManager->Clear();
+	_pItemManager->Reset();
+	_pWedgewormManager->Reset();
+	_pPlayerManager->Reset();
+	_pGameFlowManager->Reset();
+	_pSkyDome->Reset();
+	_pNum->Reset();
+
+	// tF[hCn߂
+	_frame = Application::GetInstance().GetConstantInt("FRAME_NUM") * 2;
+	_updateFunc = &ScenePve::FadeInUpdate;
+	_drawFunc = &ScenePve::FadeInDraw;
+
+	// ̗ƁAXNvgœpbh̓͂߂ɂ
+	srand(Application::GetInstance().GetMatchSeed());
+	Input::GetInstance().RestartDevices();
+
+	// vC[̍XV
+	_pPlayerManager->Update();
+}
+
 void ScenePve::NormalUpdate()
 {
 	// BGMĐ	
@@ -127,6 +157,10 @@ void ScenePve::NormalUpdate()
 
 	// Q[IĂȈɈڂ
 	if (_pGameFlowManager->GetGameEnd()) {
+
+		// Io̊ԂɃUgV[̃AZbgǂݍł
+		AssetLoader::GetInstance().Request("data/manifest/SceneResult.csv");
+
 		_updateFunc = &ScenePve::EndUpdate;
 		_drawFunc = &ScenePve::EndDraw;
 	}
@@ -179,7 +213,7 @@ void ScenePve::EndUpdate()
 	if (_frame >= Application::GetInstance().GetConstantInt("FRAME_NUM") * 2) {
 
 		SoundManager::GetInstance().StopBGM(BGM_BATTLE);
-		SceneManager::GetInstance().ChangeScene(std::make_shared<SceneResult>(_pPlayerManager->GetPlayerData(), _pGameFlowManager->GetGameTime()));
+		SceneManager::GetInstance().ChangeScene(std::make_shared<SceneResult>(_pPlayerManager->GetPlayerData(), _pGameFlowManager->GetGameTime(), shared_from_this()));
 	}
 }
 
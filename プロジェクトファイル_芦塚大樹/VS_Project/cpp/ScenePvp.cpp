@@ -19,6 +19,8 @@
 #include "EffekseerForDXLib.h"
 #include "PlayerBulletCollisionManager.h"
 #include "ItemManager.h"
+#include "DynamicResolution.h"
+#include "AssetLoader.h"
 
 ScenePvp::ScenePvp(PlayerData data) :
 	_frame(Application::GetInstance().GetConstantInt("FRAME_NUM") * 2)
@@ -42,6 +44,7 @@ ScenePvp::ScenePvp(PlayerData data) :
 		_pNum = std::make_shared<NumUtility>(GetConstantFloat("NUM_SIZE"), Vec2{ GetConstantFloat("NUM_POS_X"),GetConstantFloat("NUM_POS_Y") });	// [eBeB
 		_pPlayerBulletCollisionManager = std::make_shared<PlayerBulletCollisionManager>(_pBulletManager, _pPlayerManager);
 		_pItemManager = std::make_shared<ItemManager>(_pPlayerManager, _pStage);
+		_pResolution = std::make_shared<DynamicResolution>();	// 𑜓x̔{
 	}
 
 	// Cg̐ݒ
@@ -68,6 +71,10 @@ ScenePvp::ScenePvp(PlayerData data) :
 		_drawFunc = &ScenePvp::FadeInDraw;
 	}
 
+	// ̗ƁAXNvgœpbh̓͂߂ɂ
+	srand(Application::GetInstance().GetMatchSeed());
+	Input::GetInstance().RestartDevices();
+
 	// vC[̍XV
 	_pPlayerManager->Update();
 
@@ -81,6 +88,11 @@ ScenePvp::~ScenePvp()
 	// Cg̍폜
 	DeleteLightHandleAll();
 
+	// XN[̍폜
+	for (auto& screen : _screen) {
+		DeleteGraph(screen);
+	}
+
 	// `͈͂ƕ`̒S̏
 	SetDrawArea(0, 0, Application::GetInstance().GetConstantInt("SCREEN_WIDTH"), Application::GetInstance().GetConstantInt("SCREEN_HEIGHT"));
 	SetCameraScreenCenter(static_cast<float>(Application::GetInstance().GetConstantInt("SCREEN_WIDTH") / 2), static_cast<float>(Application::GetInstance().GetConstantInt("SCREEN_HEIGHT") / 2));
@@ -93,9 +105,47 @@ void ScenePvp::Update()
 
 void ScenePvp::Draw() const
 {
+	// GPU̕`悪d΃XN[̉𑜓x𗎂Ƃ
+	// (eBbN̐Ɋ֌WȂA`悵t[ƂɒÕt[̕`掞Ԃ1g)
+	_pResolution->Update(Application::GetInstance().GetGpuTime());
+	if (_pResolution->IsChanged()) {
+		MakeScreen();
+	}
+
 	(this->*_drawFunc)();
 }
 
+void ScenePvp::Reset()
+{
+	// ɕς̂Jn̏Ԃɖ߂(蒼Ɏg)
+	_pStage->ResetStage();
+	_pBulletManager->Clear();
+	_pItemManager->Reset();
+	_pWedgewormManager->Reset();
+	_pPlayerManager->Reset();
+	_pGameFlowManager->Reset();
+	_pSkyDome->Reset();
+	_pNum->Reset();
+
+	// 𑜓x̔{őɖ߂
+	_pResolution->Reset();
+	if (_pResolution->IsChanged()) {
+		MakeScreen();
+	}
+
+	// tF[hCn߂
+	_frame = Application::GetInstance().GetConstantInt("FRAME_NUM") * 2;
+	_updateFunc = &ScenePvp::FadeInUpdate;
+	_drawFunc = &ScenePvp::FadeInDraw;
+
+	// ̗ƁAXNvgœpbh̓͂߂ɂ
+	srand(Application::GetInstance().GetMatchSeed());
+	Input::GetInstance().RestartDevices();
+
+	// vC[̍XV
+	_pPlayerManager->Update();
+}
+
 void ScenePvp::NormalUpdate()
 {
 	// BGMĐ	
@@ -131,6 +181,10 @@ void ScenePvp::NormalUpdate()
 
 	// Q[IĂȈɈڂ
 	if (_pGameFlowManager->GetGameEnd()) {
+
+		// Io̊ԂɃUgV[̃AZbgǂݍł
+		AssetLoader::GetInstance().Request("data/manifest/SceneResult.csv");
+
 		_updateFunc = &ScenePvp::EndUpdate;
 		_drawFunc = &ScenePvp::EndDraw;
 	}
@@ -174,7 +228,7 @@ void ScenePvp::NormalDraw() const
 		_pItemManager->Draw();
 
 		// vC[̕`
-		_pPlayerManager->Draw(i);
+		_pPlayerManager->DrawPlayer();
 
 	}
 
@@ -183,17 +237,26 @@ void ScenePvp::NormalDraw() const
 
 	auto& app = Application::GetInstance();
 
+	int width = app.GetConstantInt("SCREEN_WIDTH");
+	int height = app.GetConstantInt("SCREEN_HEIGHT");
 
-	// XN[̕`
+	// XN[̕`(𑜓x𗎂ƂĂĂʂςɈL΂)
 	if (_pPlayerManager->GetPlayerNum() == 2) {
-		DrawGraph(0, 0, _screen[0], true);
-		DrawGraph(app.GetConstantInt("SCREEN_WIDTH") / 2, 0, _screen[1], true);
+		DrawExtendGraph(0, 0, width / 2, height, _screen[0], true);
+		DrawExtendGraph(width / 2, 0, width, height, _screen[1], true);
 	}
 	else if (_pPlayerManager->GetPlayerNum() > 2) {
-		DrawGraph(0, 0, _screen[0], true);
-		DrawGraph(app.GetConstantInt("SCREEN_WIDTH") / 2, 0, _screen[1], true);
-		DrawGraph(0, app.GetConstantInt("SCREEN_HEIGHT") / 2, _screen[2], true);
-		DrawGraph(app.GetConstantInt("SCREEN_WIDTH") / 2, app.GetConstantInt("SCREEN_HEIGHT") / 2, _screen[3], true);
+		DrawExtendGraph(0, 0, width / 2, height / 2, _screen[0], true);
+		DrawExtendGraph(width / 2, 0, width, height / 2, _screen[1], true);
+		DrawExtendGraph(0, height / 2, width / 2, height, _screen[2], true);
+		DrawExtendGraph(width / 2, height / 2, width, height, _screen[3], true);
+	}
+
+	// UI̓XN[̉𑜓xɊ֌WȂAL΂ʂ̏ɕ`悷
+	for (int i = 0; i < _pPlayerManager->GetPlayerNum(); i++) {
+		int x = (i % 2) * (width / 2);
+		int y = _pPlayerManager->GetPlayerNum() == 2 ? 0 : (i / 2) * (height / 2);
+		_pPlayerManager->DrawUi(i, x, y);
 	}
 
 	// Ԃ̍XV
@@ -214,7 +277,8 @@ void ScenePvp::EndUpdate()
 	if (_frame >= Application::GetInstance().GetConstantInt("FRAME_NUM") * 2) {
 
 		SoundManager::GetInstance().StopBGM(BGM_BATTLE);
-		SceneManager::GetInstance().ChangeScene(std::make_shared<SceneResult>(_pPlayerManager->GetPlayerData(), _pGameFlowManager->GetGameTime()));
+		Application::GetInstance().OnMatchEnd(_pPlayerManager->GetPlayerData().winner, _pGameFlowManager->GetGameTime());
+		SceneManager::GetInstance().ChangeScene(std::make_shared<SceneResult>(_pPlayerManager->GetPlayerData(), _pGameFlowManager->GetGameTime(), shared_from_this()));
 	}
 }
 
@@ -247,18 +311,30 @@ void ScenePvp::FadeInDraw() const
 	SetDrawBlendMode(DX_BLENDMODE_NOBLEND, 0);
 }
 
-void ScenePvp::MakeScreen()
+void ScenePvp::MakeScreen() const
 {
 	auto& app = Application::GetInstance();
 
+	// ÕXN[폜
+	for (auto& screen : _screen) {
+		DeleteGraph(screen);
+	}
+	_screen.clear();
+
+	// 𑜓x̔{TCYō쐬
+	int width = _pResolution->ScaleSize(app.GetConstantInt("SCREEN_WIDTH") / 2);
+	int height = app.GetConstantInt("SCREEN_HEIGHT");
+
 	if (_pPlayerManager->GetPlayerNum() == 2) {
-		_screen.push_back(DxLib::MakeScreen(app.GetConstantInt("SCREEN_WIDTH") / 2, app.GetConstantInt("SCREEN_HEIGHT"), true));
-		_screen.push_back(DxLib::MakeScreen(app.GetConstantInt("SCREEN_WIDTH") / 2, app.GetConstantInt("SCREEN_HEIGHT"), true));
+		height = _pResolution->ScaleSize(height);
+		_screen.push_back(DxLib::MakeScreen(width, height, true));
+		_screen.push_back(DxLib::MakeScreen(width, height, true));
 	}
 	else {
-		_screen.push_back(DxLib::MakeScreen(app.GetConstantInt("SCREEN_WIDTH") / 2, app.GetConstantInt("SCREEN_HEIGHT") / 2, true));
-		_screen.push_back(DxLib::MakeScreen(app.GetConstantInt("SCREEN_WIDTH") / 2, app.GetConstantInt("SCREEN_HEIGHT") / 2, true));
-		_screen.push_back(DxLib::MakeScreen(app.GetConstantInt("SCREEN_WIDTH") / 2, app.GetConstantInt("SCREEN_HEIGHT") / 2, true));
-		_screen.push_back(DxLib::MakeScreen(app.GetConstantInt("SCREEN_WIDTH") / 2, app.GetConstantInt("SCREEN_HEIGHT") / 2, true));
+		height = _pResolution->ScaleSize(height / 2);
+		_screen.push_back(DxLib::MakeScreen(width, height, true));
+		_screen.push_back(DxLib::MakeScreen(width, height, true));
+		_screen.push_back(DxLib::MakeScreen(width, height, true));
+		_screen.push_back(DxLib::MakeScreen(width, height, true));
 	}
 }
@@ -14,11 +14,13 @@
 #include "Effekseer.h"
 #include <EffekseerForDXLib.h>
 #include "Application.h"
+#include "AssetLoader.h"
 
-SceneResult::SceneResult(PlayerData data, int gameTime) :
+SceneResult::SceneResult(PlayerData data, int gameTime, std::shared_ptr<SceneBase> battleScene) :
 	_playerData(data),
 	_frame(0),
-	_nextScene(0)
+	_nextScene(0),
+	_pBattleScene(battleScene)
 {
 	// 萔t@C̓ǂݍ
 	ReadCSV("data/constant/SceneResult.csv");
@@ -87,6 +89,11 @@ void SceneResult::NormalUpdate()
 				_nextScene = SCENE_PVP;
 			}
 
+			// ogV[g񂹂ȂƂ́AtF[hAEg̊ԂɎ̃V[̃AZbgǂݍł
+			if (!_pBattleScene) {
+				AssetLoader::GetInstance().Request(_nextScene == SCENE_PVE ? "data/manifest/ScenePve.csv" : "data/manifest/ScenePvp.csv");
+			}
+
 			// tF[hAEgɈڍs
 			_updateFunc = &SceneResult::FadeOutUpdate;
 			_drawFunc = &SceneResult::FadeOutDraw;
@@ -95,6 +102,7 @@ void SceneResult::NormalUpdate()
 		// B{^ꂽ^Cg
 		if (Input::GetInstance().IsTrigger(INPUT_B, num)) {
 			_nextScene = SCENE_TITLE;
+			AssetLoader::GetInstance().Request("data/manifest/SceneTitle.csv");
 			_updateFunc = &SceneResult::FadeOutUpdate;
 			_drawFunc = &SceneResult::FadeOutDraw;
 		}
@@ -133,6 +141,13 @@ void SceneResult::FadeOutUpdate()
 
 	// tF[hI
 	if (_frame > Application::GetInstance().GetConstantInt("FRAME_NUM") * 2) {
+		// ogV[Ă΁Aŏ̏Ԃɖ߂Ă̂܂܍Đ킷
+		if (_pBattleScene && (_nextScene == SCENE_PVP || _nextScene == SCENE_PVE)) {
+			_pBattleScene->Reset();
+			SceneManager::GetInstance().ChangeScene(_pBattleScene);
+			return;
+		}
+
 		// ̃V[ɐ؂ւ
 		switch (_nextScene)
 		{
@@ -11,6 +11,7 @@
 #include "ScenePause.h"
 #include "SceneSelectMode.h"
 #include "Application.h"
+#include "AtlasManager.h"
 
 SceneSelect::SceneSelect(int num) :
 	_frame(0)
@@ -36,14 +37,14 @@ SceneSelect::SceneSelect(int num) :
 	}
 
 	// XCh摜̃[h
-	_slideHandle = LoadGraph("data/image/Slide.png");
+	_slideHandle = AtlasManager::GetInstance().LoadGraph("data/image/Slide.png");
 
 	_slidePos = Vec2{ GetConstantInt("SLIDE_OUT_START_X"),GetConstantInt("SLIDE_OUT_START_Y") };
 }
 
 SceneSelect::~SceneSelect()
 {
-	DeleteGraph(_slideHandle);
+	AtlasManager::GetInstance().DeleteGraph(_slideHandle);
 }
 
 void SceneSelect::Update()
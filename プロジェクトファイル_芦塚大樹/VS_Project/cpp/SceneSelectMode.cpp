@@ -11,6 +11,8 @@
 #include "SceneTutorial.h"
 #include "SceneSelectNum.h"
 #include "Application.h"
+#include "AtlasManager.h"
+#include "AssetLoader.h"
 
 SceneSelectMode::SceneSelectMode(bool slideInFlag) :
 	_titleFrag(false),
@@ -31,7 +33,7 @@ SceneSelectMode::SceneSelectMode(bool slideInFlag) :
 	_pSkyDome = std::make_shared<SkyDome>();
 
 	// XCh摜̃[h
-	_slideHandle = LoadGraph("data/image/Slide.png");
+	_slideHandle = AtlasManager::GetInstance().LoadGraph("data/image/Slide.png");
 
 	// ZNgV[߂ĂXCh摜͍J
 	if (_returnSelectFrag) {
@@ -53,7 +55,7 @@ SceneSelectMode::SceneSelectMode(bool slideInFlag) :
 
 SceneSelectMode::~SceneSelectMode()
 {
-	DeleteGraph(_slideHandle);
+	AtlasManager::GetInstance().DeleteGraph(_slideHandle);
 }
 
 void SceneSelectMode::Update()
@@ -82,6 +84,9 @@ void SceneSelectMode::NormalUpdate()
 		// ^Cgɖ߂tO𗧂Ă
 		_titleFrag = true;
 
+		// XCh̊ԂɃ^Cg̃AZbgǂݍł
+		AssetLoader::GetInstance().Request("data/manifest/SceneTitle.csv");
+
 		// XCh摜̏ʒuݒ肷
 		_slidePos.x = GetConstantInt("SLIDE_OUT_END_X");
 
@@ -101,6 +106,11 @@ void SceneSelectMode::NormalUpdate()
 		case MULTI_MODE:
 		case TUTORIAL_MODE:
 
+			// XCh̊ԂɃ`[gÃAZbgǂݍł
+			if (_pUi->GetSelect() == TUTORIAL_MODE) {
+				AssetLoader::GetInstance().Request("data/manifest/SceneTutorial.csv");
+			}
+
 			// XCh摜̏ʒuݒ肷
 			_slidePos.x = GetConstantInt("SLIDE_IN_START_X");
 
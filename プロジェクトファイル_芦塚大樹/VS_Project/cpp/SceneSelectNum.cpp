@@ -8,6 +8,7 @@
 #include "PlayerManager.h"
 #include "SceneSelect.h"
 #include "Application.h"
+#include "AtlasManager.h"
 
 SceneSelectNum::SceneSelectNum() :
 	_selectFrag(false),
@@ -28,7 +29,7 @@ SceneSelectNum::SceneSelectNum() :
 	_pSkyDome = std::make_shared<SkyDome>();
 
 	// XCh摜̃[h
-	_slideHandle = LoadGraph("data/image/Slide.png");
+	_slideHandle = AtlasManager::GetInstance().LoadGraph("data/image/Slide.png");
 
 	_slidePos.x = GetConstantInt("SLIDE_OUT_START_X");
 
@@ -39,7 +40,7 @@ SceneSelectNum::SceneSelectNum() :
 	SetCameraNearFar(GetConstantFloat("CAMERA_NEAR"), GetConstantFloat("CAMERA_FAR"));
 
 	// warning摜̃[h
-	_warningHandle = LoadGraph("data/image/warning.png");
+	_warningHandle = AtlasManager::GetInstance().LoadGraph("data/image/warning.png");
 
 	// BGM̍Đ
 	SoundManager::GetInstance().StartBGM(BGM_OPENING);
@@ -47,8 +48,8 @@ SceneSelectNum::SceneSelectNum() :
 
 SceneSelectNum::~SceneSelectNum()
 {
-	DeleteGraph(_slideHandle);
-	DeleteGraph(_warningHandle);
+	AtlasManager::GetInstance().DeleteGraph(_slideHandle);
+	AtlasManager::GetInstance().DeleteGraph(_warningHandle);
 }
 
 void SceneSelectNum::Update()
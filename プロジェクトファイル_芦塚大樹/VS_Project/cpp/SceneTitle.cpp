@@ -11,6 +11,8 @@
 #include "SceneSelectMode.h"
 #include "SceneCredit.h"
 #include "Application.h"
+#include "AtlasManager.h"
+#include "AssetLoader.h"
 
 SceneTitle::SceneTitle(bool slidInFlag) :
 	_frame(Application::GetInstance().GetConstantInt("FRAME_NUM")),
@@ -76,20 +78,20 @@ SceneTitle::SceneTitle(bool slidInFlag) :
 	}
 
 	// XCh摜̃[h
-	_slideHandle = LoadGraph("data/image/Slide.png");
+	_slideHandle = AtlasManager::GetInstance().LoadGraph("data/image/Slide.png");
 
 	// Zt摜̃[h
-	_serihu = LoadGraph("data/image/message2.png");
+	_serihu = AtlasManager::GetInstance().LoadGraph("data/image/message2.png");
 
-	_serihu2 = LoadGraph("data/image/message3.png");
+	_serihu2 = AtlasManager::GetInstance().LoadGraph("data/image/message3.png");
 
-	_serihu3 = LoadGraph("data/image/message4.png");
+	_serihu3 = AtlasManager::GetInstance().LoadGraph("data/image/message4.png");
 
 	// Q[I摜̃[h
-	_endHandle = LoadGraph("data/image/GameEnda.png");
+	_endHandle = AtlasManager::GetInstance().LoadGraph("data/image/GameEnda.png");
 
 	// Q[I{^eLXg摜
-	_gameEndHandle = LoadGraph("data/image/startToGameEnd.png");
+	_gameEndHandle = AtlasManager::GetInstance().LoadGraph("data/image/startToGameEnd.png");
 
 	// I[vjÕe[}Đ
 	SoundManager::GetInstance().StopBGM(BGM_THEME);
@@ -101,12 +103,12 @@ SceneTitle::SceneTitle(bool slidInFlag) :
 
 SceneTitle::~SceneTitle()
 {
-	DeleteGraph(_serihu);
-	DeleteGraph(_serihu2);
-	DeleteGraph(_serihu3);
-	DeleteGraph(_slideHandle);
-	DeleteGraph(_endHandle);
-	DeleteGraph(_gameEndHandle);
+	AtlasManager::GetInstance().DeleteGraph(_serihu);
+	AtlasManager::GetInstance().DeleteGraph(_serihu2);
+	AtlasManager::GetInstance().DeleteGraph(_serihu3);
+	AtlasManager::GetInstance().DeleteGraph(_slideHandle);
+	AtlasManager::GetInstance().DeleteGraph(_endHandle);
+	AtlasManager::GetInstance().DeleteGraph(_gameEndHandle);
 }
 
 void SceneTitle::Update()
@@ -144,6 +146,9 @@ void SceneTitle::NormalUpdate()
 
 				_frame = 0;
 
+				// tF[hAEg̊ԂɃNWbg̃AZbgǂݍł
+				AssetLoader::GetInstance().Request("data/manifest/SceneCredit.csv");
+
 				// tF[hAEg
 				_updateFunc = &SceneTitle::NormalFadeOutUpdate;
 				_drawFunc = &SceneTitle::NormalFadeDraw;
@@ -153,6 +158,9 @@ void SceneTitle::NormalUpdate()
 				// 艹炷
 				SoundManager::GetInstance().RingSE(SE_TITLE_START);
 
+				// XCh̊ԂɃ[hĨAZbgǂݍł
+				AssetLoader::GetInstance().Request("data/manifest/SceneSelectMode.csv");
+
 				// lIֈڍs
 				_updateFunc = &SceneTitle::SlideOutUpdate;
 				_drawFunc = &SceneTitle::SlideOutDraw;
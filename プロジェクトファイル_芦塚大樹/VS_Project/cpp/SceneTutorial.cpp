@@ -5,6 +5,7 @@
 #include "SoundManager.h"
 #include "Application.h"
 #include "Constant.h"
+#include "AssetLoader.h"
 
 SceneTutorial::SceneTutorial():
 	_frame(Application::GetInstance().GetConstantInt("FRAME_NUM"))
@@ -40,7 +41,11 @@ void SceneTutorial::Draw() const
 void SceneTutorial::NormalUpdate()
 {
 	// `[gAItF[hAEgɈڍs
-	if (_pManager->GetEndFrag()) {
+	if (_pManager->GetEndFrag() && _updateFunc != &SceneTutorial::FadeOutUpdate) {
+
+		// tF[hAEg̊ԂɃ[hĨAZbgǂݍł
+		AssetLoader::GetInstance().Request("data/manifest/SceneSelectMode.csv");
+
 		_updateFunc = &SceneTutorial::FadeOutUpdate;
 		_drawFunc = &SceneTutorial::FadeOutDraw;
 	}
@@ -2,6 +2,7 @@
 #include "DxLib.h"
 #include "Application.h"
 #include "Input.h"
+#include "AtlasManager.h"
 
 SelectFinger::SelectFinger(int padNum) :
 	_padNum(padNum),
@@ -16,16 +17,16 @@ SelectFinger::SelectFinger(int padNum) :
 	switch (padNum)
 	{
 	case 0:
-		_fingerHandle = LoadGraph("data/image/finger_down_red.png");
+		_fingerHandle = AtlasManager::GetInstance().LoadGraph("data/image/finger_down_red.png");
 		break;
 	case 1:
-		_fingerHandle = LoadGraph("data/image/finger_down_blue.png");
+		_fingerHandle = AtlasManager::GetInstance().LoadGraph("data/image/finger_down_blue.png");
 		break;
 	case 2:
-		_fingerHandle = LoadGraph("data/image/finger_down_green.png");
+		_fingerHandle = AtlasManager::GetInstance().LoadGraph("data/image/finger_down_green.png");
 		break;
 	case 3:
-		_fingerHandle = LoadGraph("data/image/finger_down_yellow.png");
+		_fingerHandle = AtlasManager::GetInstance().LoadGraph("data/image/finger_down_yellow.png");
 		break;
 	default:
 		_fingerHandle = 0;
@@ -36,7 +37,7 @@ SelectFinger::SelectFinger(int padNum) :
 SelectFinger::~SelectFinger()
 {
 	// 摜̍폜
-	DeleteGraph(_fingerHandle);
+	AtlasManager::GetInstance().DeleteGraph(_fingerHandle);
 }
 
 void SelectFinger::Update()
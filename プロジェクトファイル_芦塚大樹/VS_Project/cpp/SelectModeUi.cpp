@@ -4,6 +4,8 @@
 #include "MyMath.h"
 #include "Vec3.h"
 #include "SoundManager.h"
+#include "AtlasManager.h"
+#include <algorithm>
 
 SelectModeUi::SelectModeUi(bool selectMode) :
 	_selectButtonNum(SOLO_MODE),
@@ -16,64 +18,64 @@ SelectModeUi::SelectModeUi(bool selectMode) :
 	// 摜̃[h
 	{
 		// ̉~
-		_circleHandle[SOLO_MODE] = LoadGraph("data/image/CenterCircle1.png");
-		_circleHandle[MULTI_MODE] = LoadGraph("data/image/CenterCircle2.png");
-		_circleHandle[TUTORIAL_MODE] = LoadGraph("data/image/CenterCircle3.png");
-		_circleHandle[OPTION_MODE] = LoadGraph("data/image/CenterCircle4.png");
+		_circleHandle[SOLO_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/CenterCircle1.png");
+		_circleHandle[MULTI_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/CenterCircle2.png");
+		_circleHandle[TUTORIAL_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/CenterCircle3.png");
+		_circleHandle[OPTION_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/CenterCircle4.png");
 
-		_circleLogoHandle = LoadGraph("data/image/CenterCircleLogo.png");
+		_circleLogoHandle = AtlasManager::GetInstance().LoadGraph("data/image/CenterCircleLogo.png");
 
-		_centerArrowHandle[SOLO_MODE] = LoadGraph("data/image/CenterArrow1.png");
-		_centerArrowHandle[MULTI_MODE] = LoadGraph("data/image/CenterArrow2.png");
-		_centerArrowHandle[TUTORIAL_MODE] = LoadGraph("data/image/CenterArrow3.png");
-		_centerArrowHandle[OPTION_MODE] = LoadGraph("data/image/CenterArrow4.png");
+		_centerArrowHandle[SOLO_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/CenterArrow1.png");
+		_centerArrowHandle[MULTI_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/CenterArrow2.png");
+		_centerArrowHandle[TUTORIAL_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/CenterArrow3.png");
+		_centerArrowHandle[OPTION_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/CenterArrow4.png");
 
 		// {^
 		if (selectMode) {
-			_buttonHandle[SOLO_MODE] = LoadGraph("data/image/Button1.png");
-			_buttonHandle[MULTI_MODE] = LoadGraph("data/image/Button2.png");
-			_buttonHandle[TUTORIAL_MODE] = LoadGraph("data/image/Button3.png");
-			_buttonHandle[OPTION_MODE] = LoadGraph("data/image/Button4.png");
+			_buttonHandle[SOLO_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/Button1.png");
+			_buttonHandle[MULTI_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/Button2.png");
+			_buttonHandle[TUTORIAL_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/Button3.png");
+			_buttonHandle[OPTION_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/Button4.png");
 		}
 		else {
-			_buttonHandle[SOLO_MODE] = LoadGraph("data/image/PlayerNum1.png");
-			_buttonHandle[MULTI_MODE] = LoadGraph("data/image/PlayerNum2.png");
-			_buttonHandle[TUTORIAL_MODE] = LoadGraph("data/image/PlayerNum3.png");
-			_buttonHandle[OPTION_MODE] = LoadGraph("data/image/PlayerNum4.png");
+			_buttonHandle[SOLO_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/PlayerNum1.png");
+			_buttonHandle[MULTI_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/PlayerNum2.png");
+			_buttonHandle[TUTORIAL_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/PlayerNum3.png");
+			_buttonHandle[OPTION_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/PlayerNum4.png");
 		}
 
 		// t[
-		_frameHandle[SOLO_MODE] = LoadGraph("data/image/Frame1.png");
-		_frameHandle[MULTI_MODE] = LoadGraph("data/image/Frame2.png");
-		_frameHandle[TUTORIAL_MODE] = LoadGraph("data/image/Frame3.png");
-		_frameHandle[OPTION_MODE] = LoadGraph("data/image/Frame4.png");
+		_frameHandle[SOLO_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/Frame1.png");
+		_frameHandle[MULTI_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/Frame2.png");
+		_frameHandle[TUTORIAL_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/Frame3.png");
+		_frameHandle[OPTION_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/Frame4.png");
 
 		// nCCg
-		_highlightHandle[SOLO_MODE] = LoadGraph("data/image/Highlight1.png");
-		_highlightHandle[MULTI_MODE] = LoadGraph("data/image/Highlight2.png");
-		_highlightHandle[TUTORIAL_MODE] = LoadGraph("data/image/Highlight3.png");
-		_highlightHandle[OPTION_MODE] = LoadGraph("data/image/Highlight4.png");
+		_highlightHandle[SOLO_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/Highlight1.png");
+		_highlightHandle[MULTI_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/Highlight2.png");
+		_highlightHandle[TUTORIAL_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/Highlight3.png");
+		_highlightHandle[OPTION_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/Highlight4.png");
 
 		// bZ[W
 		if (selectMode) {
-			_messageHandle[SOLO_MODE] = LoadGraph("data/image/Message01.png");
-			_messageHandle[MULTI_MODE] = LoadGraph("data/image/Message02.png");
-			_messageHandle[TUTORIAL_MODE] = LoadGraph("data/image/Message03.png");
-			_messageHandle[OPTION_MODE] = LoadGraph("data/image/Message04.png");
+			_messageHandle[SOLO_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/Message01.png");
+			_messageHandle[MULTI_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/Message02.png");
+			_messageHandle[TUTORIAL_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/Message03.png");
+			_messageHandle[OPTION_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/Message04.png");
 		}
 		else {
-			_messageHandle[SOLO_MODE] = LoadGraph("data/image/Play1.png");
-			_messageHandle[MULTI_MODE] = LoadGraph("data/image/Play2.png");
-			_messageHandle[TUTORIAL_MODE] = LoadGraph("data/image/Play3.png");
-			_messageHandle[OPTION_MODE] = LoadGraph("data/image/Play4.png");
+			_messageHandle[SOLO_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/Play1.png");
+			_messageHandle[MULTI_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/Play2.png");
+			_messageHandle[TUTORIAL_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/Play3.png");
+			_messageHandle[OPTION_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/Play4.png");
 		}
 		
 
 		// ]
-		_marginHandle[SOLO_MODE] = LoadGraph("data/image/Margin1.png");
-		_marginHandle[MULTI_MODE] = LoadGraph("data/image/Margin2.png");
-		_marginHandle[TUTORIAL_MODE] = LoadGraph("data/image/Margin3.png");
-		_marginHandle[OPTION_MODE] = LoadGraph("data/image/Margin4.png");
+		_marginHandle[SOLO_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/Margin1.png");
+		_marginHandle[MULTI_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/Margin2.png");
+		_marginHandle[TUTORIAL_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/Margin3.png");
+		_marginHandle[OPTION_MODE] = AtlasManager::GetInstance().LoadGraph("data/image/Margin4.png");
 	}
 
 	// {^摜̍Wݒ肷
@@ -88,21 +90,24 @@ SelectModeUi::SelectModeUi(bool selectMode) :
 	// ŏɑIĂ鍀ڂ̐ݒ
 	_selectButtonNum = TUTORIAL_MODE;
 	_oldSelectButtonNum = _selectButtonNum;
+
+	// Iɍ킹UIL^
+	Record();
 }
 
 SelectModeUi::~SelectModeUi()
 {
 	// 摜̍폜
 	for (int i = 0; i < OPTION_MODE; i++) {
-		DeleteGraph(_circleHandle[i]);
-		DeleteGraph(_centerArrowHandle[i]);
-		DeleteGraph(_buttonHandle[i]);
-		DeleteGraph(_highlightHandle[i]);
-		DeleteGraph(_messageHandle[i]);
-		DeleteGraph(_marginHandle[i]);
+		AtlasManager::GetInstance().DeleteGraph(_circleHandle[i]);
+		AtlasManager::GetInstance().DeleteGraph(_centerArrowHandle[i]);
+		AtlasManager::GetInstance().DeleteGraph(_buttonHandle[i]);
+		AtlasManager::GetInstance().DeleteGraph(_highlightHandle[i]);
+		AtlasManager::GetInstance().DeleteGraph(_messageHandle[i]);
+		AtlasManager::GetInstance().DeleteGraph(_marginHandle[i]);
 	}
 
-	DeleteGraph(_circleLogoHandle);
+	AtlasManager::GetInstance().DeleteGraph(_circleLogoHandle);
 }
 
 void SelectModeUi::Update()
@@ -139,9 +144,14 @@ void SelectModeUi::Update()
 	// IĂ{^ۑ
 	_oldSelectButtonNum = _selectButtonNum;
 
+	// IςƂUIL^
+	if (_recordButtonNum != _selectButtonNum) {
+		Record();
+	}
+
 	// ~̊g嗦ύX
 	_circleScale += 0.05;
-	_circleScale = min(1.0, _circleScale);
+	_circleScale = (std::min)(1.0, _circleScale);
 
 
 	// IĂ{^ɂĊpxς
@@ -179,34 +189,47 @@ void SelectModeUi::Update()
 
 void SelectModeUi::Draw() const
 {
-	SetDrawBlendMode(DX_BLENDMODE_ALPHA, 50);
-	DrawBox(0, 0, 1980, 1080, 0x000000, true);
-	SetDrawBlendMode(DX_BLENDMODE_NOBLEND, 0);
+	// wiA{^A]At[̕`
+	_backBatch.Draw();
+
+	// ̉~͖t[̂ł̂܂ܕ`悷
+	DrawRotaGraph(_circlePos.intX(), _circlePos.intY(), _circleScale, 0.0, _circleHandle[_selectButtonNum], true);
+	DrawRotaGraph(_circlePos.intX(), _circlePos.intY(), _circleScale, 0.0, _circleLogoHandle, true);
+	DrawRotaGraph(_circlePos.intX() + _arrowVec.intX(), _circlePos.intY() + _arrowVec.intY(), _circleScale, _circleAngle, _centerArrowHandle[_selectButtonNum], true);
 
-	// {^̃nCCg̕`
-	DrawGraph(_buttonPos[_selectButtonNum].intX(), _buttonPos[_selectButtonNum].intY(), _highlightHandle[_selectButtonNum], true);
+	// ̎lpƃbZ[W̕`
+	_frontBatch.Draw();
+}
 
-	// {^̕`
+void SelectModeUi::Record()
+{
+	_backBatch.Clear();
+	_frontBatch.Clear();
+
+	// ʂÂ
+	_backBatch.AddBox(0, 0, 1980, 1080, 0x000000, 0, DX_BLENDMODE_ALPHA, 50);
+
+	// {^̃nCCg
+	_backBatch.AddGraph(_buttonPos[_selectButtonNum].intX(), _buttonPos[_selectButtonNum].intY(), _highlightHandle[_selectButtonNum], 1);
+
+	// {^
 	for (int i = 0; i < 4; i++) {
-		//DrawRotaGraph(_buttonPos[i].intX(), _buttonPos[i].intY(), 1.0f, 0.0, _buttonHandle[i], true);
-		DrawGraph(_buttonPos[i].intX(), _buttonPos[i].intY(), _buttonHandle[i], true);
+		_backBatch.AddGraph(_buttonPos[i].intX(), _buttonPos[i].intY(), _buttonHandle[i], 2);
 	}
 
+	// ̉~̗]
+	_backBatch.AddRotaGraph(_circlePos.intX(), _circlePos.intY(), 1.0, 0.0, _marginHandle[_selectButtonNum], 3);
 
-	// ̉~̕`
-	DrawRotaGraph(_circlePos.intX(), _circlePos.intY(), 1.0, 0.0, _marginHandle[_selectButtonNum], true);
+	// t[
+	_backBatch.AddGraph(_buttonPos[_selectButtonNum].intX(), _buttonPos[_selectButtonNum].intY(), _frameHandle[_selectButtonNum], 4);
 
-	// t[̕`
-	DrawGraph(_buttonPos[_selectButtonNum].intX(), _buttonPos[_selectButtonNum].intY(), _frameHandle[_selectButtonNum], true);
-	DrawRotaGraph(_circlePos.intX(), _circlePos.intY(), _circleScale, 0.0, _circleHandle[_selectButtonNum], true);
-	DrawRotaGraph(_circlePos.intX(), _circlePos.intY(), _circleScale, 0.0, _circleLogoHandle, true);
-	DrawRotaGraph(_circlePos.intX() + _arrowVec.intX(), _circlePos.intY() + _arrowVec.intY(), _circleScale, _circleAngle, _centerArrowHandle[_selectButtonNum], true);
+	// ̎lp
+	_frontBatch.AddBox(0, 986, 1920, 1080, 0x000000, 0, DX_BLENDMODE_NOBLEND, 0);
 
-	// ̎lp̕`
-	DrawBox(0, 986, 1920, 1080, 0x000000, true);
+	// ̃bZ[W
+	_frontBatch.AddRotaGraph(960, 1033, 1.0, 0.0, _messageHandle[_selectButtonNum], 1);
 
-	// ̃bZ[Wnh
-	DrawRotaGraph(960, 1033, 1.0, 0.0, _messageHandle[_selectButtonNum], true);
+	_recordButtonNum = _selectButtonNum;
 }
 
 int SelectModeUi::GetSelect() const
@@ -1,13 +1,14 @@
 #include "SelectUI.h"
 #include "DxLib.h"
+#include "AtlasManager.h"
 
 SelectUI::SelectUI()
 {
 	// ͉摜̃[h
-	_selectFighterHandle = LoadGraph("data/image/SelectFighter.png");
+	_selectFighterHandle = AtlasManager::GetInstance().LoadGraph("data/image/SelectFighter.png");
 
 	// ߂摜̃[h
-	_returnHandle = LoadGraph("data/image/return.png");
+	_returnHandle = AtlasManager::GetInstance().LoadGraph("data/image/return.png");
 }
 
 SelectUI::~SelectUI()
@@ -1,10 +1,32 @@
 #include "SkyDome.h"
 #include "DxLib.h"
+#include "ModelManager.h"
+
+namespace {
+	// ̂1ʂĂtƂ̃J̌
+	struct SkyFace {
+		VECTOR front;	// 
+		VECTOR up;		// 
+	};
+
+	// +X,-X,+Y,-Y,+Z,-Z̏
+	constexpr SkyFace SKY_FACE[SKY_FACE_NUM] = {
+		{ {  1.0f,  0.0f,  0.0f }, { 0.0f, 1.0f,  0.0f } },
+		{ { -1.0f,  0.0f,  0.0f }, { 0.0f, 1.0f,  0.0f } },
+		{ {  0.0f,  1.0f,  0.0f }, { 0.0f, 0.0f, -1.0f } },
+		{ {  0.0f, -1.0f,  0.0f }, { 0.0f, 0.0f,  1.0f } },
+		{ {  0.0f,  0.0f,  1.0f }, { 0.0f, 1.0f,  0.0f } },
+		{ {  0.0f,  0.0f, -1.0f }, { 0.0f, 1.0f,  0.0f } },
+	};
+}
 
 SkyDome::SkyDome()
 {
+	// 萔t@C̓ǂݍ
+	ReadCSV("data/constant/SkyDome.csv");
+
 	// f̏
-	InitModel(MV1LoadModel("data/model/Dome.mv1"));
+	InitModel(ModelManager::GetInstance().Duplicate("data/model/Dome.mv1"));
 
 
 	// g嗦̐ݒ
@@ -14,24 +36,134 @@ SkyDome::SkyDome()
 	Position = Vec3{ 100.0f,100.0f,0.0f };
 
 	// x̐ݒ𔽉f
+	// (]͕`ŗ̂Ɋ|̂ŁAf͉]Ȃ܂܏Ăt)
 	UpdateModel(GetTransformInstance());
+
+	// ܂ĂtĂȂ
+	for (auto& screen : _faceScreen) {
+		screen = -1;
+	}
 }
 
 SkyDome::~SkyDome()
 {
+	// ĂtXN[̍폜
+	for (auto& screen : _faceScreen) {
+		if (screen != -1) {
+			DeleteGraph(screen);
+		}
+	}
 }
 
 void SkyDome::Update()
 {
 	// Âh[yĉ_ĂӂɌ
 	Angle.y += 0.0005f;
+}
 
-	// f̍XV
-	UpdateModel(GetTransformInstance());
+void SkyDome::Reset()
+{
+	Angle.y = 0.0f;
 }
 
 void SkyDome::Draw() const
 {
-	// `揈
-	DrawModel();
+	// ߂Ă̕`ŏĂt
+	if (_faceScreen[0] == -1) {
+		Bake();
+	}
+
+	// J𒆐SɁAt@[Ɏ܂傫̗̂u
+	VECTOR eye = GetCameraPosition();
+	float half = GetCameraFar() * 0.5f;
+
+	// h[̉]͗̂Ɋ|
+	MATRIX rotMtx = MGetRotY(Angle.y);
+
+	COLOR_U8 white = GetColorU8(255, 255, 255, 255);
+	COLOR_U8 black = GetColorU8(0, 0, 0, 0);
+
+	// ͈ԉȂ̂ŁAZobt@g킸ɕ`Č̕`ɏ㏑
+	int drawMode = GetDrawMode();
+	SetUseZBuffer3D(FALSE);
+	SetWriteZBuffer3D(FALSE);
+	SetUseBackCulling(FALSE);
+	SetDrawMode(DX_DRAWMODE_BILINEAR);
+
+	// ʂƂɖ@Ⴄ̂ŁACeBOgƖʂ̋ڂŖ邳ςČ
+	SetUseLighting(FALSE);
+	SetTextureAddressMode(DX_TEXADDRESS_CLAMP);
+
+	for (int i = 0; i < SKY_FACE_NUM; i++) {
+		VECTOR front = VTransform(SKY_FACE[i].front, rotMtx);
+		VECTOR up = VTransform(SKY_FACE[i].up, rotMtx);
+		VECTOR right = VCross(up, front);
+
+		// Ăt摜̍EEEEE̕
+		VERTEX3D corner[4];
+		for (int j = 0; j < 4; j++) {
+			float u = static_cast<float>(j % 2);
+			float v = static_cast<float>(j / 2);
+
+			VECTOR dir = VAdd(front, VAdd(VScale(right, u * 2.0f - 1.0f), VScale(up, 1.0f - v * 2.0f)));
+
+			corner[j].pos = VAdd(eye, VScale(dir, half));
+			corner[j].norm = VScale(front, -1.0f);
+			corner[j].dif = white;
+			corner[j].spc = black;
+			corner[j].u = u;
+			corner[j].v = v;
+			corner[j].su = 0.0f;
+			corner[j].sv = 0.0f;
+		}
+
+		VERTEX3D vertex[6] = { corner[0], corner[1], corner[2], corner[2], corner[1], corner[3] };
+		DrawPolygon3D(vertex, 2, _faceScreen[i], FALSE);
+	}
+
+	// ݒ߂(CeBOApplicationŗLɂ܂܎gĂ)
+	SetUseLighting(TRUE);
+	SetTextureAddressMode(DX_TEXADDRESS_WRAP);
+	SetDrawMode(drawMode);
+	SetUseBackCulling(TRUE);
+	SetUseZBuffer3D(TRUE);
+	SetWriteZBuffer3D(TRUE);
+}
+
+void SkyDome::Bake() const
+{
+	int size = GetConstantInt("FACE_SIZE");
+	VECTOR eye = VGet(GetConstantFloat("BAKE_EYE_X"), GetConstantFloat("BAKE_EYE_Y"), GetConstantFloat("BAKE_EYE_Z"));
+
+	// `؂ւƃJƕ`͈͂̐ݒ肪߂̂őޔĂ
+	int drawScreen = GetDrawScreen();
+	RECT drawArea;
+	GetDrawArea(&drawArea);
+	float cameraNear = GetCameraNear();
+	float cameraFar = GetCameraFar();
+	MATRIX view = GetCameraViewMatrix();
+	MATRIX projection = GetCameraProjectionMatrix();
+	float centerX = 0.0f;
+	float centerY = 0.0f;
+	GetCameraScreenCenter(&centerX, &centerY);
+
+	// Xe[W̐^񒆂AʂƂɉp90xŎʂ
+	for (int i = 0; i < SKY_FACE_NUM; i++) {
+		_faceScreen[i] = MakeScreen(size, size, false);
+
+		SetDrawScreen(_faceScreen[i]);
+		ClearDrawScreen();
+		SetCameraNearFar(GetConstantFloat("BAKE_NEAR"), GetConstantFloat("BAKE_FAR"));
+		SetupCamera_Perspective(DX_PI_F / 2.0f);
+		SetCameraPositionAndTargetAndUpVec(eye, VAdd(eye, SKY_FACE[i].front), SKY_FACE[i].up);
+		DrawModel();
+	}
+
+	// `ƃJɖ߂
+	SetDrawScreen(drawScreen);
+	SetDrawArea(drawArea.left, drawArea.top, drawArea.right, drawArea.bottom);
+	SetCameraNearFar(cameraNear, cameraFar);
+	SetCameraViewMatrix(view);
+	SetupCamera_ProjectionMatrix(projection);
+	SetCameraScreenCenter(centerX, centerY);
 }
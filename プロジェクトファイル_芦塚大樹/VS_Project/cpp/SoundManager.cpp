@@ -1,37 +1,76 @@
 #include "SoundManager.h"
 #include "DxLib.h"
+#include "TraceRecorder.h"
+#include <algorithm>
+
+// SEƂ̃t@CEށEDxEɖ点鐔
+struct SeSource {
+	const char* path;
+	int category;
+	int priority;
+	int voiceNum;
+};
+
+constexpr SeSource SE_SOURCE[MAX_SE_NUM] = {
+	{ "data/SE/SelectSound.mp3", SE_CATEGORY_UI, 1, 2 },				// SE_NUM_SELECT
+	{ "data/SE/StartSound.mp3", SE_CATEGORY_UI, 3, 1 },				// SE_TITLE_START
+	{ "data/SE/CharactorSelectSound.mp3", SE_CATEGORY_UI, 2, 4 },		// SE_CHARA_SELECT
+	{ "data/SE/CancelSound.mp3", SE_CATEGORY_UI, 2, 4 },				// SE_CHARA_CANCEL
+	{ "data/SE/GameStartSound.mp3", SE_CATEGORY_JINGLE, 4, 1 },		// SE_GAME_START
+	{ "data/SE/Result_Victory.mp3", SE_CATEGORY_JINGLE, 5, 1 },		// SE_RESULT
+	{ "data/SE/TitleShout.mp3", SE_CATEGORY_JINGLE, 4, 1 },			// SE_SHOUT
+	{ "data/SE/Beep.mp3", SE_CATEGORY_UI, 1, 2 },						// SE_BEEP
+	{ "data/SE/OpenMenu.mp3", SE_CATEGORY_UI, 2, 1 },					// SE_OPEN_MENU
+	{ "data/SE/CloseMenu.mp3", SE_CATEGORY_UI, 2, 1 },				// SE_CLOSE_MENU
+	{ "data/SE/BulletSelect.mp3", SE_CATEGORY_UI, 1, 4 },				// SE_BULLET_SELECT
+	{ "data/SE/ShotNormalBullet.mp3", SE_CATEGORY_SHOT, 1, 4 },		// SE_SHOT_NORMAL_BULET
+	{ "data/SE/ShotGrappleBullet.mp3", SE_CATEGORY_SHOT, 2, 4 },		// SE_SHOT_GRAPPLE_BULET
+	{ "data/SE/ShotBombBullet.mp3", SE_CATEGORY_SHOT, 2, 4 },			// SE_SHOT_BOMB_BULET
+	{ "data/SE/Explosion.mp3", SE_CATEGORY_IMPACT, 3, 4 },			// SE_EXPLOSION
+	{ "data/SE/Destruction.mp3", SE_CATEGORY_IMPACT, 1, 4 },			// SE_DESTRUCTION
+	{ "data/SE/Grapple.mp3", SE_CATEGORY_IMPACT, 2, 2 },				// SE_GRAPPLE
+	{ "data/SE/KO.mp3", SE_CATEGORY_JINGLE, 5, 2 },					// SE_KO
+};
+
+// ނƂ̓ɖ点鐔̒萔
+constexpr const char* SE_CATEGORY_LIMIT[MAX_SE_CATEGORY_NUM] = {
+	"UI_VOICE_NUM",		// SE_CATEGORY_UI
+	"SHOT_VOICE_NUM",	// SE_CATEGORY_SHOT
+	"IMPACT_VOICE_NUM",	// SE_CATEGORY_IMPACT
+	"JINGLE_VOICE_NUM",	// SE_CATEGORY_JINGLE
+};
 
 void SoundManager::Init()
 {
+	// 萔t@C̓ǂݍ
+	ReadCSV("data/constant/SoundManager.csv");
+
 	// ̃[h
 
 	// BGM
+	// PCMɓWJƐ\MBɂȂ̂ŁAĐȂt@C班ǂݍ
+	// (WJDxLib̃TEhXbhōs)
 	{
+		TraceScope trace("LoadBGM", "load");
+		SetCreateSoundDataType(DX_SOUNDDATATYPE_FILE);
 		_bgmMap[BGM_OPENING] = LoadSoundMem("data/BGM/Title_BGM.mp3");
 		_bgmMap[BGM_THEME] = LoadSoundMem("data/BGM/Credit_BGM.mp3");
 		_bgmMap[BGM_BATTLE] = LoadSoundMem("data/BGM/intrusion_loop.ogg");
 	}
 
 	//SE
+	// ZĂɖ炵̂ŁAPCMɓWJăɒuĂ
+	// mp3̓WJDxLib̔񓯊ǂݍ݃XbhōsAN҂Ȃ
+	// 1̃nh1̉炷悤ɂAɖ炷͓ǂݍ݌ɕ
 	{
-		_seMap[SE_NUM_SELECT] = LoadSoundMem("data/SE/SelectSound.mp3");
-		_seMap[SE_TITLE_START] = LoadSoundMem("data/SE/StartSound.mp3");
-		_seMap[SE_CHARA_SELECT] = LoadSoundMem("data/SE/CharactorSelectSound.mp3");
-		_seMap[SE_CHARA_CANCEL] = LoadSoundMem("data/SE/CancelSound.mp3");
-		_seMap[SE_GAME_START] = LoadSoundMem("data/SE/GameStartSound.mp3");
-		_seMap[SE_RESULT] = LoadSoundMem("data/SE/Result_Victory.mp3");
-		_seMap[SE_SHOUT] = LoadSoundMem("data/SE/TitleShout.mp3");
-		_seMap[SE_BEEP] = LoadSoundMem("data/SE/Beep.mp3");
-		_seMap[SE_OPEN_MENU] = LoadSoundMem("data/SE/OpenMenu.mp3");
-		_seMap[SE_CLOSE_MENU] = LoadSoundMem("data/SE/CloseMenu.mp3");
-		_seMap[SE_BULLET_SELECT] = LoadSoundMem("data/SE/BulletSelect.mp3");
-		_seMap[SE_SHOT_NORMAL_BULET] = LoadSoundMem("data/SE/ShotNormalBullet.mp3");
-		_seMap[SE_SHOT_GRAPPLE_BULET] = LoadSoundMem("data/SE/ShotGrappleBullet.mp3");
-		_seMap[SE_SHOT_BOMB_BULET] = LoadSoundMem("data/SE/ShotBombBullet.mp3");
-		_seMap[SE_EXPLOSION] = LoadSoundMem("data/SE/Explosion.mp3");
-		_seMap[SE_DESTRUCTION] = LoadSoundMem("data/SE/Destruction.mp3");
-		_seMap[SE_GRAPPLE] = LoadSoundMem("data/SE/Grapple.mp3");
-		_seMap[SE_KO] = LoadSoundMem("data/SE/KO.mp3");
+		TraceScope trace("RequestSE", "load");
+		_seLoadTime = TraceRecorder::GetInstance().GetTime();
+		SetCreateSoundDataType(DX_SOUNDDATATYPE_MEMNOPRESS);
+		SetUseASyncLoadFlag(true);
+		for (int se = 0; se < MAX_SE_NUM; se++) {
+			_seMap[se] = LoadSoundMem(SE_SOURCE[se].path, 1);
+		}
+		SetUseASyncLoadFlag(false);
 	}
 
 	// ʂ̐ݒ
@@ -39,10 +78,7 @@ void SoundManager::Init()
 	for (auto& [key, value] : _bgmMap) {
 		ChangeVolumeSoundMem(VOLUME_MIDDLE, value);
 	}
-	// SE
-	for (auto& [key, value] : _seMap) {
-		ChangeVolumeSoundMem(VOLUME_MIDDLE, value);
-	}
+	// SE͓ǂݍݒ̃nhɐGƓǂݍ݂҂Ă܂̂ŁA炷Ƃɐݒ肷
 }
 
 void SoundManager::StartBGM(int bgm)
@@ -57,9 +93,99 @@ void SoundManager::StopBGM(int bgm)
 	StopSoundMem(_bgmMap[bgm]);
 }
 
+void SoundManager::Update()
+{
+	// ǂݍ݂̏ISE点悤ɂ
+	CreateVoicePool();
+
+	// ǂݍ݂҂ĂSEÃt[̂̂ƈꏏɖ炷
+	_command.insert(_command.end(), _waiting.begin(), _waiting.end());
+	_waiting.clear();
+
+	// ÎO
+	for (int i = static_cast<int>(_playing.size()) - 1; i >= 0; i--) {
+		if (CheckSoundMem(_playing[i].handle) != 1) {
+			_playing.erase(_playing.begin() + i);
+		}
+	}
+
+	// Dx̍̂炷
+	std::stable_sort(_command.begin(), _command.end(), [](const SeCommand& a, const SeCommand& b) {
+		return SE_SOURCE[a.se].priority > SE_SOURCE[b.se].priority;
+	});
+
+	// SE𓯂ꏊ炵̂(ʒuȂ̂́Aǂ炵ĂƂ)
+	auto isSameEmitter = [](const SeCommand& a, const SeCommand& b) {
+		if (a.se != b.se || a.hasPos != b.hasPos) return false;
+		return !a.hasPos || (a.pos.x == b.pos.x && a.pos.y == b.pos.y && a.pos.z == b.pos.z);
+	};
+
+	// t[ɓꏊς܂ꂽSE1񂾂炷
+	// ʂ̃vC[eɖ炵̂́ASE𓯎ɖ点鐔܂Ŗ炷
+	// (ʂ𕪂ĂƂɁAЕ̃vC[̉Ȃ悤ɂ)
+	std::vector<SeCommand> played;
+	int playedNum[MAX_SE_NUM] = {};
+
+	float cullDistance = GetConstantFloat("CULL_DISTANCE");
+	int waitFrame = GetConstantInt("WAIT_FRAME");
+	for (auto& command : _command) {
+		if (playedNum[command.se] >= SE_SOURCE[command.se].voiceNum) continue;
+		if (std::any_of(played.begin(), played.end(), [&](const SeCommand& other) { return isSameEmitter(command, other); })) continue;
+
+		// ǂݍ݂IĂȂ΁Ãt[ɂ܂炷
+		if (_voicePool[command.se].empty()) {
+			if (_seMap[command.se] == -1) {
+				LogFileFmtAdd("SoundManager: %s ǂݍ߂Ȃ̂Ŗ炵܂ł", SE_SOURCE[command.se].path);
+			}
+			else if (_frame - command.frame >= waitFrame) {
+				LogFileFmtAdd("SoundManager: %s ̓ǂݍ݂%dt[ŏIȂ̂Ŗ炵܂ł", SE_SOURCE[command.se].path, waitFrame);
+			}
+			else if (std::none_of(_waiting.begin(), _waiting.end(), [&](const SeCommand& waiting) { return isSameEmitter(command, waiting); })) {
+				_waiting.push_back(command);
+			}
+			continue;
+		}
+
+		// ǂ̃vC[͖炳Ȃ
+		if (command.hasPos && !_listener.empty()) {
+			bool isNear = false;
+			for (auto& listener : _listener) {
+				if ((command.pos - listener).Length() <= cullDistance) {
+					isNear = true;
+					break;
+				}
+			}
+			if (!isNear) continue;
+		}
+
+		if (PlayVoice(command)) {
+			played.push_back(command);
+			playedNum[command.se]++;
+		}
+	}
+
+	_command.clear();
+	_listener.clear();
+	_frame++;
+}
+
 void SoundManager::RingSE(int se)
 {
-	PlaySoundMem(_seMap[se],DX_PLAYTYPE_BACK);
+	if (se < 0 || se >= MAX_SE_NUM) return;
+
+	_command.push_back(SeCommand{ se, false, Vec3{}, _frame });
+}
+
+void SoundManager::RingSE(int se, const Vec3& pos)
+{
+	if (se < 0 || se >= MAX_SE_NUM) return;
+
+	_command.push_back(SeCommand{ se, true, pos, _frame });
+}
+
+void SoundManager::AddListener(const Vec3& pos)
+{
+	_listener.push_back(pos);
 }
 
 void SoundManager::SetVolumeBGM(int volume)
@@ -75,8 +201,9 @@ void SoundManager::SetVolumeBGM(int volume)
 
 void SoundManager::SetVolumeSE(int volume)
 {
-	for (auto& [key, value] : _seMap) {
-		ChangeVolumeSoundMem(volume, value);
+	// Ă̂ς(ق͖炷Ƃɐݒ肷)
+	for (auto& voice : _playing) {
+		ChangeVolumeSoundMem(volume, voice.handle);
 	}
 
 	// ʂۑ
@@ -92,3 +219,81 @@ int SoundManager::GetVolumeSE()
 {
 	return _volumeSE;
 }
+
+void SoundManager::CreateVoicePool()
+{
+	for (int se = 0; se < MAX_SE_NUM; se++) {
+		if (!_voicePool[se].empty()) continue;
+
+		// ǂݍݒǂݍ݂Ɏŝ͂܂点Ȃ
+		if (_seMap[se] == -1 || CheckHandleASyncLoad(_seMap[se]) != FALSE) continue;
+
+		// ǂݍ݂n߂Ă点悤ɂȂ܂łL^
+		TraceRecorder::GetInstance().AddAsyncSpan("DecodeSE", "load", SE_SOURCE[se].path, _seLoadTime, TraceRecorder::GetInstance().GetTime());
+
+		// WJPCMLnh
+		_voicePool[se].push_back(_seMap[se]);
+		for (int i = 1; i < SE_SOURCE[se].voiceNum; i++) {
+			int handle = DuplicateSoundMem(_seMap[se], 1);
+			if (handle != -1) _voicePool[se].push_back(handle);
+		}
+	}
+}
+
+bool SoundManager::PlayVoice(const SeCommand& command)
+{
+	const SeSource& source = SE_SOURCE[command.se];
+	auto& pool = _voicePool[command.se];
+	if (pool.empty()) return false;
+
+	// ނ̏ɒBĂ΁ADxႢ̂ňԌÂ̂~߂
+	int categoryNum = 0;
+	int victim = -1;
+	for (int i = 0; i < static_cast<int>(_playing.size()); i++) {
+		const Voice& voice = _playing[i];
+		if (SE_SOURCE[voice.se].category != source.category) continue;
+
+		categoryNum++;
+		if (voice.priority > source.priority) continue;
+		if (victim == -1 || voice.priority < _playing[victim].priority ||
+			(voice.priority == _playing[victim].priority && voice.startFrame < _playing[victim].startFrame)) {
+			victim = i;
+		}
+	}
+	if (categoryNum >= GetConstantInt(SE_CATEGORY_LIMIT[source.category])) {
+		if (victim == -1) return false;
+		StopVoice(victim);
+	}
+
+	// 󂢂ĂnhTAȂ΂SEňԌÂ̂~߂Ďg
+	int handle = -1;
+	for (auto& candidate : pool) {
+		auto it = std::find_if(_playing.begin(), _playing.end(), [candidate](const Voice& voice) { return voice.handle == candidate; });
+		if (it == _playing.end()) {
+			handle = candidate;
+			break;
+		}
+	}
+	if (handle == -1) {
+		int oldest = -1;
+		for (int i = 0; i < static_cast<int>(_playing.size()); i++) {
+			if (_playing[i].se != command.se) continue;
+			if (oldest == -1 || _playing[i].startFrame < _playing[oldest].startFrame) oldest = i;
+		}
+		if (oldest == -1) return false;
+		handle = _playing[oldest].handle;
+		StopVoice(oldest);
+	}
+
+	ChangeVolumeSoundMem(_volumeSE, handle);
+	PlaySoundMem(handle, DX_PLAYTYPE_BACK);
+	_playing.push_back(Voice{ handle, command.se, source.priority, _frame });
+
+	return true;
+}
+
+void SoundManager::StopVoice(int index)
+{
+	StopSoundMem(_playing[index].handle);
+	_playing.erase(_playing.begin() + index);
+}
@@ -0,0 +1,168 @@
+#include "SpriteBatch.h"
+#include "AtlasManager.h"
+#include <cmath>
+
+SpriteBatch::SpriteBatch()
+{
+}
+
+SpriteBatch::~SpriteBatch()
+{
+}
+
+SpriteBatch::Sprite SpriteBatch::MakeSprite(int handle)
+{
+	Sprite sprite;
+
+	// AgX؂o摜Ȃy[W̃eNX`𒼐ڎg
+	// (y[W̉摜͈̕`ɂ܂Ƃ߂)
+	AtlasRegion region;
+	if (AtlasManager::GetInstance().GetRegion(handle, region)) {
+		int pageWidth = 0;
+		int pageHeight = 0;
+		GetGraphTextureSize(region.page, &pageWidth, &pageHeight);
+
+		sprite.page = region.page;
+		sprite.width = region.width;
+		sprite.height = region.height;
+		if (pageWidth > 0 && pageHeight > 0) {
+			sprite.u0 = static_cast<float>(region.x) / pageWidth;
+			sprite.v0 = static_cast<float>(region.y) / pageHeight;
+			sprite.u1 = static_cast<float>(region.x + region.width) / pageWidth;
+			sprite.v1 = static_cast<float>(region.y + region.height) / pageHeight;
+		}
+		return sprite;
+	}
+
+	sprite.page = handle;
+
+	// 摜TCYƃeNX`TCYUV͈̔͂߂
+	int texWidth = 0;
+	int texHeight = 0;
+	GetGraphSize(handle, &sprite.width, &sprite.height);
+	GetGraphTextureSize(handle, &texWidth, &texHeight);
+
+	if (texWidth > 0 && texHeight > 0) {
+		sprite.u1 = static_cast<float>(sprite.width) / texWidth;
+		sprite.v1 = static_cast<float>(sprite.height) / texHeight;
+	}
+
+	return sprite;
+}
+
+void SpriteBatch::Clear()
+{
+	_batch.clear();
+}
+
+void SpriteBatch::AddSprite(const Sprite& sprite, Vec2 center, double exRate, double angle, int layer, int blendMode, int blendParam)
+{
+	// S̔̃TCY
+	float halfW = static_cast<float>(sprite.width * exRate * 0.5);
+	float halfH = static_cast<float>(sprite.height * exRate * 0.5);
+
+	float s = static_cast<float>(sin(angle));
+	float c = static_cast<float>(cos(angle));
+
+	// AEAAȄɉ]_߂
+	float localX[4] = { -halfW, halfW, -halfW, halfW };
+	float localY[4] = { -halfH, -halfH, halfH, halfH };
+	VECTOR pos[4];
+	for (int i = 0; i < 4; i++) {
+		pos[i] = VGet(center.x + localX[i] * c - localY[i] * s, center.y + localX[i] * s + localY[i] * c, 0.0f);
+	}
+
+	PushQuad(FindBatch(layer, blendMode, blendParam, sprite.page), pos, sprite, GetColorU8(255, 255, 255, 255));
+}
+
+void SpriteBatch::AddRotaGraph(int x, int y, double exRate, double angle, int handle, int layer, int blendMode, int blendParam)
+{
+	AddSprite(MakeSprite(handle), Vec2{ static_cast<float>(x),static_cast<float>(y) }, exRate, angle, layer, blendMode, blendParam);
+}
+
+void SpriteBatch::AddGraph(int x, int y, int handle, int layer, int blendMode, int blendParam)
+{
+	Sprite sprite = MakeSprite(handle);
+
+	VECTOR pos[4] = {
+		VGet(static_cast<float>(x), static_cast<float>(y), 0.0f),
+		VGet(static_cast<float>(x + sprite.width), static_cast<float>(y), 0.0f),
+		VGet(static_cast<float>(x), static_cast<float>(y + sprite.height), 0.0f),
+		VGet(static_cast<float>(x + sprite.width), static_cast<float>(y + sprite.height), 0.0f),
+	};
+
+	PushQuad(FindBatch(layer, blendMode, blendParam, sprite.page), pos, sprite, GetColorU8(255, 255, 255, 255));
+}
+
+void SpriteBatch::AddBox(int x1, int y1, int x2, int y2, unsigned int color, int layer, int blendMode, int blendParam)
+{
+	VECTOR pos[4] = {
+		VGet(static_cast<float>(x1), static_cast<float>(y1), 0.0f),
+		VGet(static_cast<float>(x2), static_cast<float>(y1), 0.0f),
+		VGet(static_cast<float>(x1), static_cast<float>(y2), 0.0f),
+		VGet(static_cast<float>(x2), static_cast<float>(y2), 0.0f),
+	};
+
+	// eNX`gȂ
+	Sprite sprite;
+	sprite.page = DX_NONE_GRAPH;
+
+	COLOR_U8 dif = GetColorU8((color >> 16) & 0xff, (color >> 8) & 0xff, color & 0xff, 255);
+	PushQuad(FindBatch(layer, blendMode, blendParam, sprite.page), pos, sprite, dif);
+}
+
+void SpriteBatch::Draw() const
+{
+	for (auto& batch : _batch) {
+		SetDrawBlendMode(batch.blendMode, batch.blendParam);
+		DrawPolygon2D(batch.vertex.data(), static_cast<int>(batch.vertex.size() / 3), batch.page, true);
+	}
+	SetDrawBlendMode(DX_BLENDMODE_NOBLEND, 0);
+}
+
+bool SpriteBatch::IsEmpty() const
+{
+	return _batch.empty();
+}
+
+SpriteBatch::Batch& SpriteBatch::FindBatch(int layer, int blendMode, int blendParam, int page)
+{
+	// C[̖T
+	auto it = _batch.begin();
+	while (it != _batch.end() && it->layer <= layer) {
+		it++;
+	}
+
+	// C[̍Ō̂܂Ƃ܂ƏƂ܂Ƃ߂
+	// (Ô܂Ƃ܂ɂ܂Ƃ߂ƁAԂɋL^̂ɕ`͂̂̂ɕ`Ă܂)
+	if (it != _batch.begin()) {
+		auto& last = *(it - 1);
+		if (last.layer == layer && last.blendMode == blendMode && last.blendParam == blendParam && last.page == page) {
+			return last;
+		}
+	}
+
+	// Ⴆ΃C[̖ɒǉ
+	it = _batch.insert(it, Batch{ layer, blendMode, blendParam, page, {} });
+	return *it;
+}
+
+void SpriteBatch::PushQuad(Batch& batch, const VECTOR pos[4], const Sprite& sprite, COLOR_U8 color)
+{
+	// lUV
+	float u[4] = { sprite.u0, sprite.u1, sprite.u0, sprite.u1 };
+	float v[4] = { sprite.v0, sprite.v0, sprite.v1, sprite.v1 };
+
+	// Op`2̒_ԍ
+	constexpr int index[6] = { 0, 1, 2, 2, 1, 3 };
+
+	for (int i : index) {
+		VERTEX2D vertex;
+		vertex.pos = pos[i];
+		vertex.rhw = 1.0f;
+		vertex.dif = color;
+		vertex.u = u[i];
+		vertex.v = v[i];
+		batch.vertex.push_back(vertex);
+	}
+}
@@ -1,6 +1,7 @@
 #include "StageCollisionManager.h"
 #include "StageManager.h"
 #include <algorithm>
+#include <cfloat>
 #include "Vec2.h"
 
 StageCollisionManager::StageCollisionManager(std::shared_ptr<StageManager>& stage) :
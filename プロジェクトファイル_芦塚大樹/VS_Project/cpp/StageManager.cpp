@@ -1,19 +1,17 @@
 #include "StageManager.h"
 #include "DxLib.h"
+#include "ModelManager.h"
 
 
 StageManager::StageManager() :
-	_size(0),
-	_modelHandleGreen(0)
+	_size(0)
 {
 	// 萔̃[h
 	ReadCSV("data/constant/Stage.csv");
 
 	_size = GetConstantInt("BLOCK_SIZE");
 
-	// f̃[h
-	_modelHandleGreen = MV1LoadModel("data/model/tileMedium_forest.mv1");
-	_modelHandleRed = MV1LoadModel("data/model/tileMedium_Red.mv1");
+	auto& modelManager = ModelManager::GetInstance();
 
 	// Xe[W̏
 	for (int i = 0; i < BLOCK_NUM_X; ++i) {
@@ -25,10 +23,10 @@ StageManager::StageManager() :
 
 				// f𕡐
 				if (j == 1) {
-					_model[i][j][k] = MV1DuplicateModel(_modelHandleGreen);
+					_model[i][j][k] = modelManager.Duplicate("data/model/tileMedium_forest.mv1");
 				}
 				else {
-					_model[i][j][k] = MV1DuplicateModel(_modelHandleRed);
+					_model[i][j][k] = modelManager.Duplicate("data/model/tileMedium_Red.mv1");
 				}
 
 				// g嗦̐ݒ
@@ -50,8 +48,14 @@ StageManager::StageManager() :
 
 StageManager::~StageManager()
 {
-	MV1DeleteModel(_modelHandleGreen);
-	MV1DeleteModel(_modelHandleRed);
+	// f̍폜
+	for (int i = 0; i < BLOCK_NUM_X; i++) {
+		for (int j = 0; j < BLOCK_NUM_Y; j++) {
+			for (int k = 0; k < BLOCK_NUM_Z; k++) {
+				ModelManager::GetInstance().Release(_model[i][j][k]);
+			}
+		}
+	}
 }
 
 void StageManager::DrawStage() const
@@ -87,3 +91,14 @@ void StageManager::DeleteBox(int x, int y, int z)
 
 	_stage[x][y][z] = 0;
 }
+
+void StageManager::ResetStage()
+{
+	for (int i = 0; i < BLOCK_NUM_X; i++) {
+		for (int j = 0; j < BLOCK_NUM_Y; j++) {
+			for (int k = 0; k < BLOCK_NUM_Z; k++) {
+				_stage[i][j][k] = 1;
+			}
+		}
+	}
+}
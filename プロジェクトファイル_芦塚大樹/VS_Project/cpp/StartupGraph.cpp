@@ -0,0 +1,142 @@
+#include "StartupGraph.h"
+#include "AssetLoader.h"
+#include "TraceRecorder.h"
+#include <cassert>
+#include <chrono>
+
+StartupGraph::StartupGraph()
+{
+}
+
+StartupGraph::~StartupGraph()
+{
+}
+
+void StartupGraph::Add(const std::string& name, Thread thread, const std::vector<std::string>& depend, std::function<bool()> func)
+{
+	Node node;
+	node.name = name;
+	node.thread = thread;
+	node.dependName = depend;
+	node.func = std::move(func);
+	_node.push_back(std::move(node));
+}
+
+bool StartupGraph::Run()
+{
+	ResolveDepend();
+
+	bool isSuccess = true;
+	while (true) {
+		bool isProgress = false;
+		bool isRemain = false;
+
+		for (auto& node : _node) {
+
+			// ǂݍݗp̃XbhŎŝ̂ImF
+			if (node.state == State::Running) {
+				if (node.future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+					isRemain = true;
+					continue;
+				}
+				node.future.get();
+				node.state = node.result ? State::Done : State::Failed;
+				isProgress = true;
+			}
+
+			if (node.state != State::Wait) continue;
+
+			if (!IsReady(node)) {
+				// ˑ̎sŎsɂȂ̂͐i񂾂Ƃɂ
+				if (node.state == State::Failed) {
+					isProgress = true;
+				}
+				else {
+					isRemain = true;
+				}
+				continue;
+			}
+
+			if (node.thread == Thread::Worker) {
+				// ǂݍݗp̃Xbhɓn
+				Node* pNode = &node;
+				node.state = State::Running;
+				node.future = AssetLoader::GetInstance().Submit([pNode]() { pNode->result = Execute(*pNode); });
+				isRemain = true;
+			}
+			else {
+				// CXbĥ̂͂̏ōs
+				node.state = Execute(node) ? State::Done : State::Failed;
+			}
+			isProgress = true;
+		}
+
+		if (!isRemain) break;
+
+		// ǂݍݗp̃Xbh̏I҂ȂΏ҂
+		if (!isProgress) {
+			bool isRunning = false;
+			for (auto& node : _node) {
+				if (node.state != State::Running) continue;
+				node.future.wait_for(std::chrono::milliseconds(1));
+				isRunning = true;
+				break;
+			}
+
+			// ŝ̂Ȃi܂ȂΈˑ֌WzĂ
+			assert(isRunning);
+			if (!isRunning) {
+				isSuccess = false;
+				break;
+			}
+		}
+	}
+
+	for (auto& node : _node) {
+		if (node.state != State::Done) isSuccess = false;
+	}
+
+	_node.clear();
+
+	return isSuccess;
+}
+
+void StartupGraph::ResolveDepend()
+{
+	for (auto& node : _node) {
+		node.depend.clear();
+		for (auto& name : node.dependName) {
+			int index = -1;
+			for (int i = 0; i < static_cast<int>(_node.size()); i++) {
+				if (_node[i].name == name) {
+					index = i;
+					break;
+				}
+			}
+
+			// ǉĂȂm[hɂ͈ˑłȂ
+			assert(index != -1);
+			if (index != -1) node.depend.push_back(index);
+		}
+	}
+}
+
+bool StartupGraph::IsReady(Node& node)
+{
+	for (int index : node.depend) {
+		State state = _node[index].state;
+		if (state == State::Failed) {
+			node.state = State::Failed;
+			return false;
+		}
+		if (state != State::Done) return false;
+	}
+
+	return true;
+}
+
+bool StartupGraph::Execute(const Node& node)
+{
+	TraceScope trace(node.name.c_str(), "init");
+	return node.func();
+}
@@ -1,5 +1,6 @@
 #include "TitlePlayer.h"
 #include "DxLib.h"
+#include "ModelManager.h"
 
 TitlePlayer::TitlePlayer(int pos, int num)
 {
@@ -13,16 +14,16 @@ TitlePlayer::TitlePlayer(int pos, int num)
 	switch (num)
 	{
 	case 0:
-		InitModel(MV1LoadModel("data/model/DancePlayer1.mv1"));
+		InitModel(ModelManager::GetInstance().Duplicate("data/model/DancePlayer1.mv1"));
 		break;
 	case 1:
-		InitModel(MV1LoadModel("data/model/DancePlayer2.mv1"));
+		InitModel(ModelManager::GetInstance().Duplicate("data/model/DancePlayer2.mv1"));
 		break;
 	case 2:
-		InitModel(MV1LoadModel("data/model/DancePlayer3.mv1"));
+		InitModel(ModelManager::GetInstance().Duplicate("data/model/DancePlayer3.mv1"));
 		break;
 	case 3:
-		InitModel(MV1LoadModel("data/model/DancePlayer4.mv1"));
+		InitModel(ModelManager::GetInstance().Duplicate("data/model/DancePlayer4.mv1"));
 		break;
 	default:
 		break;
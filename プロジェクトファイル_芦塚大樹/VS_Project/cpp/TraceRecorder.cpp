@@ -0,0 +1,139 @@
+#include "TraceRecorder.h"
+#include <fstream>
+
+TraceRecorder::TraceRecorder() :
+	_start(std::chrono::steady_clock::now()),
+	_asyncCount(0),
+	_isRecording(true)
+{
+	// ŏɍXbh(CXbh)0Ԃɂ
+	_thread.push_back(std::this_thread::get_id());
+}
+
+long long TraceRecorder::GetTime() const
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - _start).count();
+}
+
+void TraceRecorder::AddSpan(const std::string& name, const char* category, const std::string& detail, long long begin, long long end)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (!_isRecording) return;
+
+	_span.push_back(Span{ name, category, detail, begin, end, GetThreadNumber(), 0 });
+}
+
+void TraceRecorder::AddAsyncSpan(const std::string& name, const char* category, const std::string& detail, long long begin, long long end)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (!_isRecording) return;
+
+	_span.push_back(Span{ name, category, detail, begin, end, -1, ++_asyncCount });
+}
+
+bool TraceRecorder::IsRecording() const
+{
+	return _isRecording;
+}
+
+void TraceRecorder::Start()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_span.clear();
+	_asyncCount = 0;
+	_isRecording = true;
+}
+
+void TraceRecorder::Finish(const std::string& path)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (!_isRecording) return;
+	_isRecording = false;
+
+	// o悪Ȃ΋L^̂Ă
+	std::ofstream file;
+	if (!path.empty()) file.open(path);
+	if (!file.is_open()) {
+		_span.clear();
+		return;
+	}
+
+	file << "{\"traceEvents\":[\n";
+
+	// XbhɖOt(0Ԃ̓CXbh)
+	for (int i = 0; i < static_cast<int>(_thread.size()); i++) {
+		file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << i
+			<< ",\"args\":{\"name\":\"" << (i == 0 ? "Main" : "Worker " + std::to_string(i)) << "\"}},\n";
+	}
+
+	for (auto& span : _span) {
+		std::string args;
+		if (!span.detail.empty()) {
+			args = ",\"args\":{\"detail\":\"" + Escape(span.detail) + "\"}";
+		}
+
+		if (span.thread >= 0) {
+			// Xbh̋Ԃ͓qɂȂ̂ŁACxg1ŏ
+			file << "{\"name\":\"" << Escape(span.name) << "\",\"cat\":\"" << span.category
+				<< "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << span.thread
+				<< ",\"ts\":" << span.begin << ",\"dur\":" << span.end - span.begin << args << "},\n";
+		}
+		else {
+			// 񓯊̋Ԃ͊JnƏĨCxgԍŌ
+			file << "{\"name\":\"" << Escape(span.name) << "\",\"cat\":\"" << span.category
+				<< "\",\"ph\":\"b\",\"id\":" << span.asyncId << ",\"pid\":1,\"tid\":0,\"ts\":" << span.begin << args << "},\n";
+			file << "{\"name\":\"" << Escape(span.name) << "\",\"cat\":\"" << span.category
+				<< "\",\"ph\":\"e\",\"id\":" << span.asyncId << ",\"pid\":1,\"tid\":0,\"ts\":" << span.end << "},\n";
+		}
+	}
+
+	// Ō̗vf̃J}󂯂邽߁AvZXŌɏ
+	file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"OtoshiKing\"}}\n";
+	file << "],\"displayTimeUnit\":\"ms\"}\n";
+
+	_span.clear();
+	_span.shrink_to_fit();
+}
+
+int TraceRecorder::GetThreadNumber()
+{
+	auto id = std::this_thread::get_id();
+	for (int i = 0; i < static_cast<int>(_thread.size()); i++) {
+		if (_thread[i] == id) return i;
+	}
+
+	_thread.push_back(id);
+	return static_cast<int>(_thread.size()) - 1;
+}
+
+std::string TraceRecorder::Escape(const std::string& text)
+{
+	std::string result;
+	for (char c : text) {
+		if (c == '"' || c == '\\') {
+			result += '\\';
+			result += c;
+		}
+		else if (static_cast<unsigned char>(c) < 0x20) {
+			result += ' ';
+		}
+		else {
+			result += c;
+		}
+	}
+	return result;
+}
+
+TraceScope::TraceScope(const char* name, const char* category, const std::string& detail) :
+	_name(name),
+	_category(category),
+	_detail(detail),
+	_begin(TraceRecorder::GetInstance().GetTime())
+{
+}
+
+TraceScope::~TraceScope()
+{
+	auto& recorder = TraceRecorder::GetInstance();
+	recorder.AddSpan(_name, _category, _detail, _begin, recorder.GetTime());
+}
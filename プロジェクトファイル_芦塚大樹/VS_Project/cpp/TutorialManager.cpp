@@ -9,6 +9,8 @@
 #include "EffectManager.h"
 #include "Input.h"
 #include "Application.h"
+#include "AtlasManager.h"
+#include <algorithm>
 
 TutorialManager::TutorialManager() :
 	_frame(0),
@@ -56,26 +58,26 @@ TutorialManager::TutorialManager() :
 	// 摜̃[h
 	{
 		// KCh͂̉摜̃[h
-		_guideHandle[GUIDE_CAMERA] = LoadGraph("data/image/GuideCamera.png");
-		_guideHandle[GUIDE_MOVE] = LoadGraph("data/image/GuideMove.png");
-		_guideHandle[GUIDE_JUMP] = LoadGraph("data/image/GuideJump.png");
-		_guideHandle[GUIDE_SHOT] = LoadGraph("data/image/GuideShot.png");
-		_guideHandle[GUIDE_BOMB] = LoadGraph("data/image/GuideBomb.png");
-		_guideHandle[GUIDE_GRAPPLE] = LoadGraph("data/image/GuideGrapple.png");
-		_guideHandle[GUIDE_END] = LoadGraph("data/image/GuideEnd.png");
-		_guideHandle[GUIDE_RETURN] = LoadGraph("data/image/GuideReturn.png");
+		_guideHandle[GUIDE_CAMERA] = AtlasManager::GetInstance().LoadGraph("data/image/GuideCamera.png");
+		_guideHandle[GUIDE_MOVE] = AtlasManager::GetInstance().LoadGraph("data/image/GuideMove.png");
+		_guideHandle[GUIDE_JUMP] = AtlasManager::GetInstance().LoadGraph("data/image/GuideJump.png");
+		_guideHandle[GUIDE_SHOT] = AtlasManager::GetInstance().LoadGraph("data/image/GuideShot.png");
+		_guideHandle[GUIDE_BOMB] = AtlasManager::GetInstance().LoadGraph("data/image/GuideBomb.png");
+		_guideHandle[GUIDE_GRAPPLE] = AtlasManager::GetInstance().LoadGraph("data/image/GuideGrapple.png");
+		_guideHandle[GUIDE_END] = AtlasManager::GetInstance().LoadGraph("data/image/GuideEnd.png");
+		_guideHandle[GUIDE_RETURN] = AtlasManager::GetInstance().LoadGraph("data/image/GuideReturn.png");
 
 
 		// NA摜̃[h
-		_clearHandle = LoadGraph("data/image/Clear.png");
+		_clearHandle = AtlasManager::GetInstance().LoadGraph("data/image/Clear.png");
 
 		// Q[̉摜[h
-		_explainHandle[0] = LoadGraph("data/image/Story1.png");
-		_explainHandle[1] = LoadGraph("data/image/Story2.png");
-		_explainHandle[2] = LoadGraph("data/image/Story3.png");
-		_explainHandle[3] = LoadGraph("data/image/Story4.png");
-		_explainHandle[4] = LoadGraph("data/image/Story5.png");
-		_explainHandle[5] = LoadGraph("data/image/Story6.png");
+		_explainHandle[0] = AtlasManager::GetInstance().LoadGraph("data/image/Story1.png");
+		_explainHandle[1] = AtlasManager::GetInstance().LoadGraph("data/image/Story2.png");
+		_explainHandle[2] = AtlasManager::GetInstance().LoadGraph("data/image/Story3.png");
+		_explainHandle[3] = AtlasManager::GetInstance().LoadGraph("data/image/Story4.png");
+		_explainHandle[4] = AtlasManager::GetInstance().LoadGraph("data/image/Story5.png");
+		_explainHandle[5] = AtlasManager::GetInstance().LoadGraph("data/image/Story6.png");
 	}
 
 	// KCh͂̍W̐ݒ
@@ -99,15 +101,15 @@ TutorialManager::~TutorialManager()
 {
 	// KCh͂̍폜
 	for (int i = 0; i < 5; i++) {
-		DeleteGraph(_guideHandle[i]);
+		AtlasManager::GetInstance().DeleteGraph(_guideHandle[i]);
 	}
 
 	// NA摜̍폜
-	DeleteGraph(_clearHandle);
+	AtlasManager::GetInstance().DeleteGraph(_clearHandle);
 
 	// Q[̉摜̍폜
 	for (int i = 0; i < 7; i++) {
-		DeleteGraph(_explainHandle[i]);
+		AtlasManager::GetInstance().DeleteGraph(_explainHandle[i]);
 	}
 }
 
@@ -396,7 +398,7 @@ bool TutorialManager::ClearFunction()
 
 	_clearScale -= static_cast<double>(GetConstantFloat("CLEAR_SCALE_RATE"));
 
-	_clearScale = max(1.0, _clearScale);
+	_clearScale = (std::max)(1.0, _clearScale);
 
 	if (_clearScale == 1.0 && _frame < 30) {
 		_clearPos.x = app.GetConstantInt("SCREEN_WIDTH") / static_cast<float>(2) + GetRand(20) - 10;
@@ -0,0 +1,174 @@
+#include "VirtualPadDevice.h"
+#include "DxLib.h"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+namespace {
+	// {^̖Oƃrbg̑g
+	struct ButtonName {
+		const char* name;
+		unsigned int bit;
+	};
+
+	// XNvgŎg{^̖O
+	constexpr ButtonName BUTTON_NAME[] = {
+		{ "A",		1u << XINPUT_BUTTON_A },
+		{ "B",		1u << XINPUT_BUTTON_B },
+		{ "X",		1u << XINPUT_BUTTON_X },
+		{ "Y",		1u << XINPUT_BUTTON_Y },
+		{ "UP",		1u << XINPUT_BUTTON_DPAD_UP },
+		{ "DOWN",	1u << XINPUT_BUTTON_DPAD_DOWN },
+		{ "LEFT",	1u << XINPUT_BUTTON_DPAD_LEFT },
+		{ "RIGHT",	1u << XINPUT_BUTTON_DPAD_RIGHT },
+		{ "START",	1u << XINPUT_BUTTON_START },
+		{ "BACK",	1u << XINPUT_BUTTON_BACK },
+		{ "LS",		1u << XINPUT_BUTTON_LEFT_THUMB },
+		{ "RS",		1u << XINPUT_BUTTON_RIGHT_THUMB },
+		{ "LB",		1u << XINPUT_BUTTON_LEFT_SHOULDER },
+		{ "RB",		1u << XINPUT_BUTTON_RIGHT_SHOULDER },
+		{ "LT",		PAD_LEFT_TRIGGER_BIT },
+		{ "RT",		PAD_RIGHT_TRIGGER_BIT },
+	};
+}
+
+VirtualPadDevice::VirtualPadDevice() :
+	_tick(0),
+	_startTick(0),
+	_row(0),
+	_sample(),
+	_hasSample(false)
+{
+}
+
+VirtualPadDevice::~VirtualPadDevice()
+{
+}
+
+bool VirtualPadDevice::LoadScript(const std::string& path, int startTick)
+{
+	std::ifstream file(path);
+	if (!file.is_open()) {
+		LogFileFmtAdd("VirtualPadDevice: %s ǂݍ߂܂ł", path.c_str());
+		return false;
+	}
+
+	_script.clear();
+
+	std::string line, tick, buttons, thumbLX, thumbLY, thumbRX, thumbRY;
+
+	// sڂ̃wb_[XLbv
+	std::getline(file, line);
+
+	while (std::getline(file, line)) {
+		if (!line.empty() && line.back() == '\r') line.pop_back();
+		if (line.empty()) continue;
+
+		std::stringstream ss(line);
+		std::getline(ss, tick, ',');
+		std::getline(ss, buttons, ',');
+		std::getline(ss, thumbLX, ',');
+		std::getline(ss, thumbLY, ',');
+		std::getline(ss, thumbRX, ',');
+		std::getline(ss, thumbRY, ',');
+
+		try {
+			ScriptRow row = {};
+			row.tick = std::stoi(tick);
+			row.sample.buttons = ParseButtons(buttons);
+			row.sample.leftTrigger = (row.sample.buttons & PAD_LEFT_TRIGGER_BIT) ? 255 : 0;
+			row.sample.rightTrigger = (row.sample.buttons & PAD_RIGHT_TRIGGER_BIT) ? 255 : 0;
+			row.sample.thumbLX = static_cast<short>(std::stoi(thumbLX));
+			row.sample.thumbLY = static_cast<short>(std::stoi(thumbLY));
+			row.sample.thumbRX = static_cast<short>(std::stoi(thumbRX));
+			row.sample.thumbRY = static_cast<short>(std::stoi(thumbRY));
+			_script.push_back(row);
+		}
+		catch (const std::exception&) {
+			LogFileFmtAdd("VirtualPadDevice: %s ̍sǂ߂܂ł(%s)", path.c_str(), line.c_str());
+		}
+	}
+
+	if (_script.empty()) return false;
+
+	// Ō̍s̃eBbNōŏɖ߂
+	int length = (std::max)(_script.back().tick, 1);
+	_startTick = startTick % length;
+
+	return Restart();
+}
+
+void VirtualPadDevice::Set(const PadSample& sample)
+{
+	_sample = sample;
+	_hasSample = true;
+}
+
+void VirtualPadDevice::Update(long long tickTime)
+{
+	if (!_script.empty()) {
+		// Ō̍s܂ŗŏɖ߂
+		if (_tick >= _script.back().tick) {
+			_tick = 0;
+			_row = 0;
+		}
+
+		// ̃eBbN̍s܂Ői߂
+		while (_row + 1 < static_cast<int>(_script.size()) && _script[_row + 1].tick <= _tick) {
+			_row++;
+		}
+
+		// ŏ̍sO͉Ȃ
+		_sample = _script[_row].tick <= _tick ? _script[_row].sample : PadSample{};
+		_hasSample = true;
+		_tick++;
+	}
+
+	// eBbN̒œ͂ꂽƂɂ
+	_sample.time = tickTime;
+}
+
+bool VirtualPadDevice::Peek(long long, PadSample& sample)
+{
+	if (!_hasSample) return false;
+
+	sample = _sample;
+	return true;
+}
+
+void VirtualPadDevice::Pop()
+{
+	_hasSample = false;
+}
+
+bool VirtualPadDevice::IsConnected() const
+{
+	return true;
+}
+
+bool VirtualPadDevice::Restart()
+{
+	if (_script.empty()) return false;
+
+	_tick = _startTick;
+	_row = 0;
+	_sample = PadSample{};
+	_hasSample = false;
+
+	return true;
+}
+
+unsigned int VirtualPadDevice::ParseButtons(const std::string& text)
+{
+	unsigned int buttons = 0;
+
+	std::stringstream ss(text);
+	std::string name;
+	while (std::getline(ss, name, '|')) {
+		for (auto& button : BUTTON_NAME) {
+			if (name == button.name) buttons |= button.bit;
+		}
+	}
+
+	return buttons;
+}
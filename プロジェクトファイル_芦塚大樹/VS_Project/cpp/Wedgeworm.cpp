@@ -3,6 +3,22 @@
 
 Wedgeworm::Wedgeworm(int num,int model):
 	_angle(0)
+{
+	// g̐ݒ
+	Scale = Vec3{ 0.1f,0.1f,0.1f };
+
+	// f̏
+	InitModel(model);
+
+	// ʒu̐ݒ
+	Reset(num);
+}
+
+Wedgeworm::~Wedgeworm()
+{
+}
+
+void Wedgeworm::Reset(int num)
 {
 	// W̐ݒ
 	_pos = Vec3{ 120.0f,50.0f,120.0f };
@@ -20,22 +36,16 @@ Wedgeworm::Wedgeworm(int num,int model):
 	// ]spxŉ]Ă
 	MATRIX mtx = MGetRotY(_angle);
 	_pos = VTransform(_pos.VGet(), mtx);
-
-	// g̐ݒ
-	Scale = Vec3{ 0.1f,0.1f,0.1f };
-
-	// f̏
-	InitModel(MV1DuplicateModel(model));
+	Position = Vec3{ 0.0f,0.0f,0.0f };
 
 	// ɉ]ʂ
 	_angle = 0.005f;
 
 	// ]s쐬
 	_mtx = MGetRotY(_angle);
-}
 
-Wedgeworm::~Wedgeworm()
-{
+	// O̎̈ʒuԂȂ
+	ResetModel();
 }
 
 void Wedgeworm::Update()
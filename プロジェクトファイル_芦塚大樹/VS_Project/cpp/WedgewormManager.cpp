@@ -1,19 +1,15 @@
 #include "WedgewormManager.h"
 #include "Wedgeworm.h"
+#include "ModelManager.h"
 
 WedgewormManager::WedgewormManager()
 {
-	// f̃[h
-	int modelHandle = MV1LoadModel("data/model/Wedgeworm.mv1");
-
-	// wormIuWFNg̏
+	// wormIuWFNg̏(f̌f[^͓ǂݍݍς݂Ȃ̂ŕ邾)
 	int num = 0;
 	for (auto& obj : _worm) {
-		obj = std::make_shared<Wedgeworm>(num, modelHandle);
+		obj = std::make_shared<Wedgeworm>(num, ModelManager::GetInstance().Duplicate("data/model/Wedgeworm.mv1"));
 		num++;
 	}
-
-	MV1DeleteModel(modelHandle);
 }
 
 WedgewormManager::~WedgewormManager()
@@ -40,3 +36,13 @@ Vec3 WedgewormManager::GetPos(int num) const
 {
 	return _worm[num]->Position;
 }
+
+void WedgewormManager::Reset()
+{
+	// f͂̂܂܎gAʒu߂
+	int num = 0;
+	for (auto& obj : _worm) {
+		obj->Reset(num);
+		num++;
+	}
+}
@@ -1,12 +1,24 @@
 #pragma once
 #include "Singleton.h"
 #include "Constant.h"
+#include <memory>
 
 namespace
 {
 	constexpr const char* WINDOW_NAME = "OtoshiKing";
+
+	// NԂ̋L^̏o
+	constexpr const char* STARTUP_TRACE_PATH = "StartupTrace.json";
+
+	// Ñt[̋L^̏o
+	constexpr const char* FRAME_TRACE_PATH = "FrameTrace.json";
+
+	// ͂̒x̋L^̏o
+	constexpr const char* LATENCY_CSV_PATH = "Latency.csv";
 };
 
+class FramePacer;
+class GpuTimer;
 class Application:
 	public Singleton<Application>,
 	public Constant
@@ -24,11 +36,115 @@ public:
 	/// </summary>
 	void Run();
 
+	/// <summary>
+	/// `悹A҂ɃeBbNi߂đΐJԂ(x`}[NEwKp)
+	/// ׂẴpbhXNvg̉z̃pbhœA߂eBbNŏI
+	/// ̎킩n߂̂ŁAĐ1ڂƓʂɂȂ邩m߂
+	/// ߂̓XbhɕɁAɌ߂̃Xbhɕēΐ킵AĂʂςȂm߂
+	/// </summary>
+	/// <returns>ׂĂ̎1ڂƓʂȂtrue</returns>
+	bool RunHeadless();
+
+	/// <summary>
+	/// ΐ킪IƂm点(I𐔂ăOɎcA1ڂƔׂ)
+	/// </summary>
+	/// <param name="winner">LN^[</param>
+	/// <param name="gameTime">ɂeBbN</param>
+	void OnMatchEnd(int winner, int gameTime);
+
+	/// <summary>
+	/// Õt[̏ɂԂԂ
+	/// </summary>
+	/// <returns>t[̏(}CNb)</returns>
+	long long GetFrameTime() const;
+
+	/// <summary>
+	/// Õt[GPU`ɂԂԂ
+	/// (ȂƂ́A҂܂܂Ȃt[̏ԂԂ)
+	/// </summary>
+	/// <returns>GPU̕`掞(}CNb)</returns>
+	long long GetGpuTime() const;
+
+	/// <summary>
+	/// ̏߂Ɏg̎Ԃ
+	/// (wbhXł͖AȊO͎)
+	/// </summary>
+	/// <returns>̎</returns>
+	unsigned int GetMatchSeed() const;
+
+	/// <summary>
+	/// vC[̍XVXbhɕĂ悢Ԃ
+	/// (wbhXŁAɍsʂƔׂƂfalseɂȂ)
+	/// </summary>
+	/// <returns>Ă悯true</returns>
+	bool IsParallelUpdate() const;
+
+	/// <summary>
+	/// t[̊Jn낦NXԂ
+	/// (ڕW̃t[[g̕ύXt[̊Ԋu̎擾Ɏg)
+	/// </summary>
+	/// <returns>t[y[T[(Run̑Onullptr)</returns>
+	std::shared_ptr<FramePacer> GetFramePacer() const;
+
 private:
 
+	/// <summary>
+	/// EBhE̐ݒ(Dxlib̏Oɍs)
+	/// </summary>
+	void InitWindow();
+
+	/// <summary>
+	/// `Ȃǂ̐ݒ(Dxlib̏ɍs)
+	/// </summary>
+	void InitScreen();
+
+	/// <summary>
+	/// ^Cg΂đΐn߂
+	/// </summary>
+	/// <param name="playerNum">l(2`4)</param>
+	void StartMatch(int playerNum);
+
+	/// <summary>
+	/// o߂Ԃ̕Q[̍XV(eBbN)i߂
+	/// </summary>
+	void Simulate();
+
+	/// <summary>
+	/// Q[̍XV1eBbNi߂
+	/// </summary>
+	/// <param name="tickTime">̃eBbN̏I̎(͎̓͂̃eBbNŎg)</param>
+	void Tick(long long tickTime);
+
 	/// <summary>
 	/// I
 	/// </summary>
 	void Terminate();
 
+	// Õt[̏(}CNb)
+	long long _frameTime = 0;
+
+	// t[̊Jn낦NX
+	std::shared_ptr<FramePacer> _pFramePacer;
+
+	// Õt[GPU`ɂ(}CNb)
+	long long _gpuTime = 0;
+
+	// GPU̕`掞Ԃ𑪂NX
+	std::shared_ptr<GpuTimer> _pGpuTimer;
+
+	// I̐
+	int _matchNum = 0;
+
+	// ̏߂Ɏg̎(0Ȃ玞g)
+	unsigned int _matchSeed = 0;
+
+	// 1ڂ̏҂ƃeBbN
+	int _firstWinner = -1;
+	int _firstGameTime = 0;
+
+	// 1ڂƌʂ̐
+	int _mismatchNum = 0;
+
+	// vC[̍XVXbhɕĂ悢
+	bool _isParallelUpdate = true;
 };
@@ -0,0 +1,132 @@
+#pragma once
+#include "Singleton.h"
+#include "DxLib.h"
+#include <map>
+#include <string>
+#include <vector>
+
+// AZbg܂Ƃ߂A[JCuɃ}bvADxLib̃t@Cǂݍ݂ɍރVOgNX
+// DxLib̃Xg[֐ւ̂ŁA摜Ef(eNX`܂)ETEhEGtFNg̓ǂݍׂ݂͂Ăʂ
+// A[JCuɓĂȂt@C͒ʏʂtH_ǂݍ
+// 摜͓ODDS(tools/dds.pyŃubNk)΂ǂݍ
+class ArchiveManager :
+	public Singleton<ArchiveManager>
+{
+	friend class Singleton<ArchiveManager>;
+
+public:
+
+	/// <summary>
+	/// A[JCuɃ}bvDxLib̓ǂݍݐɓo^
+	/// A[JCuȂĂDDSւ̍ւ̂߂ɓǂݍݐ͓o^
+	/// </summary>
+	/// <param name="path">A[JCut@C̃pX</param>
+	/// <returns>A[JCu}bvłtrue(t@CȂfalseŃtH_ǂݍ)</returns>
+	bool Mount(const std::string& path);
+
+	/// <summary>
+	/// DxLib̓ǂݍݐɖ߂A}bv
+	/// ǂݍݒ̃nhcȂ悤ADxLib_EnďɌĂ
+	/// </summary>
+	void Unmount();
+
+	/// <summary>
+	/// A[JCuɃt@CĂ邩ǂ
+	/// </summary>
+	/// <param name="path">t@C̃pX</param>
+	/// <returns>Ătrue</returns>
+	bool Contains(const std::string& path) const;
+
+private:
+
+	// vCx[gRXgN^
+	ArchiveManager();
+
+	// fXgN^
+	~ArchiveManager();
+
+	// t@Cwb_
+	struct Header {
+		char magic[4];				// "PAK1"
+		unsigned int version;		// `̃o[W
+		unsigned int entryNum;		// Ăt@C̐
+		unsigned int alignment;		// f[^̐擪낦oCg
+		unsigned long long indexOffset;	// CfbNẌʒu
+		unsigned long long indexSize;	// CfbNX̃TCY
+	};
+
+	// CfbNX1t@C
+	struct Entry {
+		unsigned long long offset = 0;		// f[^̈ʒu
+		unsigned long long storedSize = 0;	// A[JCuł̃TCY
+		unsigned long long size = 0;		// WJ̃TCY
+		unsigned int flags = 0;				// k̗LȂ
+		unsigned int crc = 0;				// WJ̃f[^CRC32
+	};
+
+	// DxLibɓnǂݍݒ̃t@C
+	struct Stream {
+		const unsigned char* data = nullptr;	// ǂݍރf[^̐擪
+		long long size = 0;						// f[^̃TCY
+		long long position = 0;					// ǂݍ݈ʒu
+		std::vector<unsigned char> buffer;		// kĂƂ̓WJ
+		HANDLE looseFile = INVALID_HANDLE_VALUE;	// A[JCuɂȂƂɒڊJt@C
+	};
+
+	/// <summary>
+	/// A[JCuɃ}bvăCfbNXǂ
+	/// </summary>
+	/// <returns>}bvłtrue</returns>
+	bool MapArchive(const std::string& path);
+
+	/// <summary>
+	/// 摜̃pXAubNkDDS̃pXT
+	/// </summary>
+	/// <returns>DDS΂̃pXAȂ΋̕</returns>
+	std::string FindCompressedTexture(const char* path) const;
+
+	/// <summary>
+	/// pXCfbNX̌p̌`ɂ낦
+	/// (؂'/'ɁApɂA擪"./"菜)
+	/// </summary>
+	static std::string NormalizePath(const char* path);
+
+	/// <summary>
+	/// LZ4̃ubNWJ
+	/// </summary>
+	/// <returns>WJłtrue</returns>
+	static bool DecodeLz4(const unsigned char* src, size_t srcSize, unsigned char* dst, size_t dstSize);
+
+	// DxLib̃Xg[֐(STREAMDATASHREDTYPE2)
+	static DWORD_PTR StreamOpen(const TCHAR* path, int useCacheFlag, int blockReadFlag, int useASyncReadFlag);
+	static int StreamClose(DWORD_PTR handle);
+	static LONGLONG StreamTell(DWORD_PTR handle);
+	static int StreamSeek(DWORD_PTR handle, LONGLONG seekPoint, int seekType);
+	static size_t StreamRead(void* buffer, size_t blockSize, size_t dataNum, DWORD_PTR handle);
+	static int StreamEof(DWORD_PTR handle);
+	static int StreamIdleCheck(DWORD_PTR handle);
+	static int StreamChDir(const TCHAR* path);
+	static int StreamGetDir(TCHAR* buffer);
+	static int StreamGetDirS(TCHAR* buffer, size_t bufferSize);
+	static DWORD_PTR StreamFindFirst(const TCHAR* filePath, FILEINFO* buffer);
+	static int StreamFindNext(DWORD_PTR findHandle, FILEINFO* buffer);
+	static int StreamFindClose(DWORD_PTR findHandle);
+
+	// }bvA[JCũt@Cnh
+	HANDLE _fileHandle;
+
+	// t@C}bsÕnh
+	HANDLE _mappingHandle;
+
+	// }bvA[JCu̐擪
+	const unsigned char* _view;
+
+	// }bvA[JCũTCY
+	unsigned long long _viewSize;
+
+	// KpXƂ̃t@C
+	std::map<std::string, Entry> _entry;
+
+	// DxLib̓ǂݍ݂̃NXɌĂ邩ǂ
+	bool _isHooked;
+};
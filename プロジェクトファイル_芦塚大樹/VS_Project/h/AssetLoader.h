@@ -0,0 +1,123 @@
+#pragma once
+#include "Singleton.h"
+#include "Constant.h"
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// V[Ƃ̐ǂ݃Xg(}jtFXg)ɏꂽAZbgobNOEhœǂݍރVOgNX
+// 摜ƃfDxLib̔񓯊ǂݍ݃XbhACSV͓ǂݍݗp̃Xbhv[œǂݍ
+// Effekseer̃GtFNg̓CXbhłǂݍ߂Ȃ̂ŁAUpdate1t[Ɍ܂ǂݍ
+// ǂݍ񂾂̂AtlasManagerEModelManagerEConstantEEffectManagerɒuÃV[̃RXgN^Ŏg
+class AssetLoader :
+	public Singleton<AssetLoader>,
+	public Constant
+{
+	friend class Singleton<AssetLoader>;
+
+public:
+
+	/// <summary>
+	/// 
+	/// 񓯊ǂݍ݂̃Xbhݒ肷̂ŁADxLib_InitOɌĂ
+	/// </summary>
+	void Init();
+
+	/// <summary>
+	/// I(ǂݍݗp̃Xbh~߂)
+	/// </summary>
+	void Terminate();
+
+	/// <summary>
+	/// }jtFXgɏꂽAZbg̐ǂ݂n߂
+	/// </summary>
+	/// <param name="manifest">}jtFXgt@C̃pX</param>
+	/// <returns>ǂݍݒׂ̂̂ďI犮future</returns>
+	std::shared_future<void> Request(const std::string& manifest);
+
+	/// <summary>
+	/// XV
+	/// ǂݍ݂̊mFAGtFNgǂݍ
+	/// </summary>
+	void Update();
+
+	/// <summary>
+	/// ǂݍ݂̐i݋擾
+	/// </summary>
+	/// <returns>0.0`1.0(ǂݍނ̂Ȃ1.0)</returns>
+	float GetProgress() const;
+
+	/// <summary>
+	/// ǂݍݒׂ̂̂ďIǂ
+	/// </summary>
+	/// <returns>IĂtrue</returns>
+	bool IsComplete() const;
+
+	/// <summary>
+	/// ǂݍݗp̃XbhɎdς
+	/// DxLib̊֐͌Ă΂Ȃ(t@C̓ǂݍ݂͂s)
+	/// </summary>
+	/// <param name="job">ʃXbhōs</param>
+	/// <returns>̊</returns>
+	std::future<void> Submit(std::function<void()> job);
+
+private:
+
+	// vCx[gRXgN^
+	AssetLoader();
+
+	// fXgN^
+	~AssetLoader();
+
+	// AZbg̎
+	enum class AssetType {
+		Graph,		// 摜
+		Model,		// 3Df
+		Csv,		// 萔t@C
+		Effect,		// GtFNg
+	};
+
+	// ǂݍݒ̃AZbg
+	struct Item {
+		AssetType type;
+		std::string path;
+		int handle = -1;			// 摜Ef̓ǂݍݒ̃nh
+		std::future<void> future;	// CSV̓ǂݍ݂̊
+		bool isDone = false;
+		long long requestTime = 0;	// ǂݍ݂n߂(NԂ̋L^p)
+	};
+
+	/// <summary>
+	/// ǂݍݗp̃Xbh̏
+	/// </summary>
+	void WorkerLoop();
+
+	// ǂݍݒ̃AZbg
+	std::vector<Item> _item;
+
+	// ǂݍݏIAZbg̐
+	int _doneNum;
+
+	// ǂݍݏI҂Ăfuture
+	std::vector<std::promise<void>> _promise;
+
+	// ǂݍݗp̃Xbh
+	std::vector<std::thread> _worker;
+
+	// ǂݍݗp̃Xbhɓnd
+	std::deque<std::packaged_task<void()>> _job;
+
+	// _jobƃXbh̏ItO
+	std::mutex _jobMutex;
+
+	// dς܂ꂽƂXbhɒm点
+	std::condition_variable _jobCondition;
+
+	// XbhItO
+	bool _isExit;
+};
@@ -0,0 +1,97 @@
+#pragma once
+#include "Singleton.h"
+#include <map>
+#include <string>
+
+// AgX͈̔
+struct AtlasRegion
+{
+	int page = -1;		// y[W̃OtBbNnh
+	int x = 0;			// y[W̍XW
+	int y = 0;			// y[W̍YW
+	int width = 0;		// 
+	int height = 0;		// 
+};
+
+// eNX`AgX摜؂oēnVOgNX
+// AgXɓĂȂ摜͒ʏʂt@Cǂݍ
+class AtlasManager :
+	public Singleton<AtlasManager>
+{
+	friend class Singleton<AtlasManager>;
+
+public:
+
+	/// <summary>
+	/// 摜ǂݍ
+	/// AgXɓĂ΃y[W؂onhԂ
+	/// </summary>
+	/// <param name="path">摜̃pX</param>
+	/// <returns>OtBbNnh</returns>
+	int LoadGraph(const std::string& path);
+
+	/// <summary>
+	/// 摜񓯊Őǂ݂Ă
+	/// AgXɓĂ΃y[WAĂȂΉ摜̂̂ǂݍ݁ALoadGraphŎg
+	/// </summary>
+	/// <param name="path">摜̃pX</param>
+	/// <returns>ǂݍݒ̃OtBbNnh(̊mFp)</returns>
+	int Preload(const std::string& path);
+
+	/// <summary>
+	/// ǂ݂܂܎gȂ摜폜
+	/// </summary>
+	void DeleteUnusedPreload();
+
+	/// <summary>
+	/// AgX؂onh̃y[W͈̔͂擾
+	/// </summary>
+	/// <param name="handle">OtBbNnh</param>
+	/// <param name="region">͈͂̊i[</param>
+	/// <returns>AgX؂onhȂtrue</returns>
+	bool GetRegion(int handle, AtlasRegion& region) const;
+
+	/// <summary>
+	/// LoadGraphœǂݍ񂾉摜폜
+	/// ؂onhȂ͈͂Y(DxLibDeleteGraphŏƔ͈͂c)
+	/// </summary>
+	/// <param name="handle">OtBbNnh</param>
+	void DeleteGraph(int handle);
+
+	/// <summary>
+	/// ǂݍ񂾃y[Wׂč폜
+	/// </summary>
+	void DeletePage();
+
+private:
+
+	// vCx[gRXgN^
+	AtlasManager();
+
+	// CfbNXɏꂽ͈
+	struct IndexEntry {
+		std::string page;	// y[W摜̃pX
+		int x;
+		int y;
+		int width;
+		int height;
+	};
+
+	/// <summary>
+	/// CfbNXt@Cǂݍ
+	/// </summary>
+	/// <param name="filename">CfbNXt@C̃pX</param>
+	void ReadIndex(const std::string& filename);
+
+	// 摜̃pXƂ͈̔
+	std::map<std::string, IndexEntry> _index;
+
+	// y[W摜̃pXƂ̃OtBbNnh
+	std::map<std::string, int> _pageHandle;
+
+	// ؂onhƂ͈̔
+	std::map<int, AtlasRegion> _region;
+
+	// ǂ݂Ă܂gĂȂ摜(AgXɓĂȂ)
+	std::map<std::string, int> _preload;
+};
@@ -47,7 +47,7 @@ private:
 	BulletManager& _bulletManager;
 
 	// GtFNg
-	std::shared_ptr<MyEffect> _explosionEffect;
+	MyEffect _explosionEffect;
 
 	// GtFNg`悷邽߂̃t[JE^
 	int _frame;
@@ -2,9 +2,9 @@
 #include "Vec3.h"
 #include "DxLib.h"
 #include "Components.h"
+#include "MyEffect.h"
 #include <memory>
 
-class MyEffect;
 class BulletManager;
 class MapBulletCollisionManager;
 class BulletBase:
@@ -111,7 +111,7 @@ protected:
 	float _gravity;
 
 	// GtFNg|C^
-	std::shared_ptr<MyEffect> _pEffect;
+	MyEffect _effect;
 
 	// a
 	float _radius;
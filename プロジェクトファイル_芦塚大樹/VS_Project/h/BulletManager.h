@@ -81,6 +81,11 @@ public:
 	/// <returns>obg̔z</returns>
 	std::list<std::shared_ptr<BulletBase>>& GetBulletList();
 
+	/// <summary>
+	/// ׂĂ̒e폜(Đp)
+	/// </summary>
+	void Clear();
+
 private:
 
 	// obgۑ郊Xgz
@@ -0,0 +1,46 @@
+#pragma once
+#include <functional>
+#include <vector>
+
+// ʂ̃XbhōsȂ𗭂߂ĂAォ烁CXbhŐς񂾏ɍsNX
+// DxLibEEffekseer̊֐ÃIuWFNgւ݂̏𗭂߂
+// ߂ĂȂƂ́Aς񂾏̏ōs
+class CommandBuffer
+{
+public:
+
+	/// <summary>
+	/// RXgN^
+	/// </summary>
+	CommandBuffer();
+
+	/// <summary>
+	/// fXgN^
+	/// </summary>
+	~CommandBuffer();
+
+	/// <summary>
+	/// ȍ~ɐς񂾏AExecuteĂԂ܂ŗ߂
+	/// </summary>
+	void Begin();
+
+	/// <summary>
+	/// ς(߂ĂȂ΂̏ōs)
+	/// </summary>
+	/// <param name="command">s</param>
+	void Push(std::function<void()> command);
+
+	/// <summary>
+	/// ߂ς񂾏ɍsA߂̂߂
+	/// CXbhŌĂ
+	/// </summary>
+	void Execute();
+
+private:
+
+	// ߂Ă鏈
+	std::vector<std::function<void()>> _command;
+
+	// ߂Ă邩ǂ
+	bool _isDeferred;
+};
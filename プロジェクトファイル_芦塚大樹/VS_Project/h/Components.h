@@ -38,11 +38,16 @@ public:
 	void InitModel(int modelHandle);
 	
 	// 3DXV
+	// `ŕԂ邽߂ɁAÕeBbÑgXtH[cĂ
 	void UpdateModel(Transform& transform);
 
 	// 3Df`揈
+	// ÕeBbNƍ̃eBbÑgXtH[Ԃĕ`悷
 	void DrawModel() const;
 
+	// Ԃ߂(UpdateModel߂Ă̍XVƂĈ)
+	void ResetModel();
+
 	// fnh̃Qb^[
 	int GetModelHandle() const;
 
@@ -55,9 +60,19 @@ protected:
 
 private:
 
+	// gXtH[săfɐݒ肷
+	void ApplyMatrix(const Transform& transform) const;
+
 	// f̃eNX`
 	int m_textureHandle = 0;
 
+	// ÕeBbNƍ̃eBbÑgXtH[
+	Transform _prevTransform;
+	Transform _currTransform;
+
+	// ŌUpdateModelĂ񂾃eBbN(-1ȂxĂłȂ)
+	int _updateTick = -1;
+
 };
 
 // Aj[V̐
@@ -123,6 +138,12 @@ public:
 
 	int GetAnimeFlame();
 
+	/// <summary>
+	/// Aj[V̒̏Ԃɖ߂
+	/// </summary>
+	/// <param name="modelHandle">fnh</param>
+	void ResetAnimation(int& modelHandle);
+
 private:
 
 	// ftHg̃uh[g
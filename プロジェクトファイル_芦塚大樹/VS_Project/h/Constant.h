@@ -2,7 +2,7 @@
 #include <map>
 #include <string>
 #include <variant>
-#include <tchar.h>
+#include <mutex>
 
 #define INT_ 0
 #define FLOAT_ 0.0f
@@ -46,6 +46,13 @@ public:
 	/// <returns>萔̒l</returns>
 	bool GetConstatBool(std::string name) const;
 
+	/// <summary>
+	/// CSVɓǂݍł
+	/// ʃXbhĂł悢Bǂݍ񂾓e͎ReadCSVŎg
+	/// </summary>
+	/// <param name="filename">t@CpX</param>
+	static void Preload(const std::string& filename);
+
 protected:
 
 	/// <summary>
@@ -56,13 +63,26 @@ protected:
 
 private:
 
+	/// <summary>
+	/// CSVǂݍŒ萔ƒlmap
+	/// </summary>
+	/// <param name="filename">t@CpX</param>
+	/// <returns>萔ƒlmap</returns>
+	static std::map<std::string, ConstantVariant> ParseCSV(const std::string& filename);
+
 	/// <summary>
 	/// ̕񂩂ϐ^𐄑
 	/// </summary>
 	/// <param name="type">_INTȂǂ̌^̕</param>
 	/// <returns>DataTypẽf[^^̂ꂩ</returns>
-	DataType GetDataType(const std::string& type);
+	static DataType GetDataType(const std::string& type);
 
 	// 萔i[mapz
 	std::map<std::string, ConstantVariant> Constants;
+
+	// xǂݍCSV̓e(t@CpX)
+	static std::map<std::string, std::map<std::string, ConstantVariant>> _csvCache;
+
+	// _csvCacheǂݍ݃XbhƋL邽߂̃~[ebNX
+	static std::mutex _csvCacheMutex;
 };
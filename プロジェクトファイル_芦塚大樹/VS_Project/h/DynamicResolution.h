@@ -0,0 +1,63 @@
+#pragma once
+#include "Constant.h"
+
+// GPU̕`掞Ԃ`𑜓x̔{߂NX
+class DynamicResolution :
+	public Constant
+{
+public:
+
+	/// <summary>
+	/// RXgN^
+	/// </summary>
+	DynamicResolution();
+
+	/// <summary>
+	/// fXgN^
+	/// </summary>
+	virtual ~DynamicResolution();
+
+	/// <summary>
+	/// XV
+	/// </summary>
+	/// <param name="gpuTime">Õt[GPU̕`掞(}CNb)</param>
+	void Update(long long gpuTime);
+
+	/// <summary>
+	/// v߂čő̔{ɖ߂(߂ǂIsChangedŕ)
+	/// </summary>
+	void Reset();
+
+	/// <summary>
+	/// ݂̉𑜓x̔{Ԃ
+	/// </summary>
+	/// <returns>𑜓x̔{</returns>
+	float GetScale() const;
+
+	/// <summary>
+	/// O̍XVŔ{ςǂԂ
+	/// </summary>
+	/// <returns>ςĂtrue</returns>
+	bool IsChanged() const;
+
+	/// <summary>
+	/// {TCYԂ
+	/// </summary>
+	/// <param name="size">̃TCY</param>
+	/// <returns>{TCY</returns>
+	int ScaleSize(int size) const;
+
+private:
+
+	// 𑜓x̔{
+	float _scale;
+
+	// vGPU̕`掞Ԃ̍v
+	long long _gpuTimeSum;
+
+	// vt[
+	int _sampleCount;
+
+	// O̍XVŔ{ςǂ
+	bool _isChanged;
+};
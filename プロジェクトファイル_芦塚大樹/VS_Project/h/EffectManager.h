@@ -1,6 +1,8 @@
 #pragma once
 #include "Singleton.h"
 #include <map>
+#include <string>
+#include <vector>
 #include "Vec3.h"
 #include "Constant.h"
 
@@ -15,6 +17,9 @@ constexpr int SPEED_UP_EFFECT = 7;
 
 constexpr int MAX_EFFECT_NUM = 8;
 
+// GtFNg̓ǂݍ݂ƍĐǗVOgNX
+// Đ̓GtFNg̎ނƂɏɗpӂgōsAɍĐł鐔𐧌
+// ĐIg͎ɍĐƂɉ̂ŁAĐ鑤Ŏ~߂肵ȂĂ悢
 class EffectManager:
 	public Singleton<EffectManager>,
 	public Constant
@@ -26,8 +31,14 @@ public:
 	/// </summary>
 	void Init();
 
+	/// <summary>
+	/// XV(Đ̃GtFNg1eBbNi߂)
+	/// </summary>
+	void Update();
+
 	/// <summary>
 	/// `揈
+	/// ̃eBbNœGtFNǵAÕeBbNƂ̊ԂԂʒuɕ`悷
 	/// </summary>
 	void Draw() const;
 
@@ -48,8 +59,68 @@ public:
 	/// </summary>
 	void DeleteEffect();
 
+	/// <summary>
+	/// t@CpXw肵ăGtFNgɓǂݍł
+	/// Effekseer̓ǂݍ݂̓CXbhłsȂ̂ŁAAssetLoader1t[ɏĂ΂
+	/// </summary>
+	/// <param name="path">GtFNgt@C̃pX</param>
+	/// <returns>ǂݍ񂾃nh(o^ĂȂpXȂ-1)</returns>
+	int Preload(const std::string& path);
+
+	/// <summary>
+	/// GtFNgĐ
+	/// 󂢂ĂgȂ΁A̎ނňԌÂ̂~߂Ďg
+	/// </summary>
+	/// <param name="effect">GtFNg̃L[</param>
+	/// <param name="pos">ʒu</param>
+	/// <returns>ĐĂGtFNg̔ԍ(ĐłȂ-1)</returns>
+	int Play(int effect, const Vec3& pos);
+
+	/// <summary>
+	/// ĐĂGtFNg̈ʒuς
+	/// eBbNƂ1xĂׂ΁A`ł͑ÕeBbN̈ʒuƂ̊ԂԂ
+	/// </summary>
+	/// <param name="instance">PlayŎ󂯎ԍ</param>
+	/// <param name="pos">W</param>
+	void SetPos(int instance, const Vec3& pos);
+
+	/// <summary>
+	/// ĐĂGtFNg̊g嗦ς
+	/// </summary>
+	/// <param name="instance">PlayŎ󂯎ԍ</param>
+	/// <param name="scale">g嗦</param>
+	void SetScale(int instance, const Vec3& scale);
+
+	/// <summary>
+	/// ĐĂGtFNg~߂Ęg󂯂
+	/// </summary>
+	/// <param name="instance">PlayŎ󂯎ԍ</param>
+	void Stop(int instance);
+
 private:
 
+	// GtFNgĐg
+	struct EffectSlot {
+		int playHandle = -1;	// Effekseer̍Đnh
+		int generation = 0;		// g񂵂(Âԍŕʂ̃GtFNgGȂ悤ɂ)
+		int order = 0;			// Đn߂
+		Vec3 prevPos;			// ÕeBbN̍W
+		Vec3 currPos;			// ̃eBbN̍W
+		int updateTick = -1;	// WŌɓeBbN
+	};
+
+	/// <summary>
+	/// ނƂ̓ɍĐł鐔߂Ęgpӂ
+	/// 1̃p[eBŇς̍vMAX_PARTICLE𒴂Ȃ悤Ɍ炷
+	/// </summary>
+	void CreateSlot();
+
+	/// <summary>
+	/// ԍĐnh擾
+	/// </summary>
+	/// <returns>Đnh(gg񂳂Ă-1)</returns>
+	int GetPlayHandle(int instance) const;
+
 	/// <summary>
 	/// w肳ꂽGtFNg[h
 	/// </summary>
@@ -58,5 +129,11 @@ private:
 
 	// GtFNg}bv
 	std::map<int, int> _effectMap;
+
+	// ނƂ̍Đg
+	std::vector<EffectSlot> _slot[MAX_EFFECT_NUM];
+
+	// Đ
+	int _playCount = 0;
 };
 
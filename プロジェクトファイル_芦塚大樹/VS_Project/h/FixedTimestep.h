@@ -0,0 +1,83 @@
+#pragma once
+#include "Singleton.h"
+#include "Constant.h"
+#include "Vec3.h"
+
+// Q[̍XV(eBbN)A`̃t[[gɊ֌WȂ܂ԊuŐi߂VOgNX
+// `̃t[ƂɁAo߂Ԃ̕eBbNi߁A]Ԃ̊ԂɎg
+// `ł͒O2eBbN̏Ԃ̊ŕԂ̂ŁAeBbN葬`悵ĂȂ߂炩ɂȂ
+class FixedTimestep :
+	public Singleton<FixedTimestep>,
+	public Constant
+{
+	friend class Singleton<FixedTimestep>;
+
+public:
+
+	/// <summary>
+	/// o߂Ԃi߁Ãt[Ői߂eBbN̐߂
+	/// `̃t[̍ŏɈxĂ
+	/// </summary>
+	/// <returns>i߂eBbN̐(0̂Ƃ)</returns>
+	int Advance();
+
+	/// <summary>
+	/// eBbN1i߂
+	/// Q[̍XV̑OɌĂ
+	/// </summary>
+	void BeginTick();
+
+	/// <summary>
+	/// ̃eBbN̔ԍ擾
+	/// </summary>
+	/// <returns>eBbN̔ԍ</returns>
+	int GetTick() const;
+
+	/// <summary>
+	/// 1eBbN̎Ԃ擾
+	/// </summary>
+	/// <returns>1eBbN̎(}CNb)</returns>
+	long long GetTickDuration() const;
+
+	/// <summary>
+	/// ÕeBbN獡̃eBbN܂ł̂ǂ`悷邩擾
+	/// </summary>
+	/// <returns>0.0(ÕeBbN)`1.0(̃eBbN)</returns>
+	float GetAlpha() const;
+
+	/// <summary>
+	/// ÕeBbNƍ̃eBbN̍WԂ
+	/// </summary>
+	/// <param name="prev">ÕeBbN̒l</param>
+	/// <param name="curr">̃eBbN̒l</param>
+	/// <returns>`Ɏgl</returns>
+	Vec3 Interpolate(const Vec3& prev, const Vec3& curr) const;
+
+	/// <summary>
+	/// ÕeBbNƍ̃eBbN̊pxA]̋߂ŕԂ
+	/// </summary>
+	/// <param name="prev">ÕeBbN̊px(WA)</param>
+	/// <param name="curr">̃eBbN̊px(WA)</param>
+	/// <returns>`Ɏgpx</returns>
+	float InterpolateAngle(float prev, float curr) const;
+
+private:
+
+	// vCx[gRXgN^
+	FixedTimestep();
+
+	// 1eBbN̎(}CNb)
+	long long _tickDuration;
+
+	// ܂eBbNɎgĂȂ
+	long long _accumulator;
+
+	// OAdvanceĂ񂾎
+	long long _lastTime;
+
+	// ̃eBbN̔ԍ
+	int _tick;
+
+	// Ԃ̊
+	float _alpha;
+};
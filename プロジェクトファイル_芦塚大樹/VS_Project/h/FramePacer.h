@@ -0,0 +1,63 @@
+#pragma once
+#include "Constant.h"
+#include <vector>
+
+// t[̊Jn낦NX
+// ̃t[̊Jn܂ŁA]TԂ̓Xbh𖰂点AO񂵂đ҂
+// Jn͑Õt[̗\莞猈߂̂ŁAxꂽt[͎̃̕t[Ŏ߂
+class FramePacer :
+	public Constant
+{
+public:
+
+	/// <summary>
+	/// RXgN^
+	/// </summary>
+	FramePacer();
+
+	/// <summary>
+	/// fXgN^
+	/// </summary>
+	virtual ~FramePacer();
+
+	/// <summary>
+	/// ڕW̃t[[gݒ肷
+	/// </summary>
+	/// <param name="fps">1b̃t[(0Ȃ҂Ȃ)</param>
+	void SetTargetFps(int fps);
+
+	/// <summary>
+	/// ̃t[̊Jn܂ő҂
+	/// t[̍Ō(ScreenFlip̌)ɌĂ
+	/// </summary>
+	void Wait();
+
+	/// <summary>
+	/// ߂̃t[̊Ԋũp[Z^CԂ
+	/// </summary>
+	/// <param name="rate">0.0`1.0(0.5ŒlA0.99Œx1%)</param>
+	/// <returns>t[̊Ԋu(}CNb)</returns>
+	long long GetPercentile(float rate) const;
+
+	/// <summary>
+	/// t[̊Ԋũp[Z^COt@Cɏo͂
+	/// </summary>
+	void Report() const;
+
+private:
+
+	// 1t[̎(}CNbA0Ȃ҂Ȃ)
+	long long _frameDuration;
+
+	// ̃t[n߂\̎
+	long long _nextTime;
+
+	// Õt[n߂
+	long long _lastTime;
+
+	// ߂̃t[̊Ԋu
+	std::vector<long long> _sample;
+
+	// ɏ_samplëʒu
+	int _sampleIndex;
+};
@@ -41,6 +41,11 @@ public:
 	/// <returns>Q[^C</returns>
 	int GetGameTime();
 
+	/// <summary>
+	/// Q[Jn̏Ԃɖ߂(Đp)
+	/// </summary>
+	void Reset();
+
 private:
 	// vC[}l[W[̎Q
 	std::shared_ptr<PlayerManager>& _playerManager;
@@ -0,0 +1,61 @@
+#pragma once
+#include "InputDevice.h"
+
+// XInput̃pbh̓͑u
+// InputSampler̃XbhĂ΁ÃL[ǂ
+// ĂȂ΁ADxLibŃeBbNƂɓǂ
+class GamepadDevice :
+	public InputDevice
+{
+public:
+
+	/// <summary>
+	/// RXgN^
+	/// </summary>
+	/// <param name="pad">pbh̔ԍ(0`3)</param>
+	GamepadDevice(int pad);
+
+	/// <summary>
+	/// fXgN^
+	/// </summary>
+	virtual ~GamepadDevice();
+
+	/// <summary>
+	/// XV(XbhœǂłȂ΂œǂ)
+	/// </summary>
+	/// <param name="tickTime">̃eBbN̏I̎</param>
+	virtual void Update(long long tickTime);
+
+	/// <summary>
+	/// ܂oĂȂ͂̐擪oɌ
+	/// </summary>
+	/// <param name="tickTime">̃eBbN̏I̎</param>
+	/// <param name="sample">擪̓͂󂯎ϐ</param>
+	/// <returns>̃eBbN̓͂cĂȂfalse</returns>
+	virtual bool Peek(long long tickTime, PadSample& sample);
+
+	/// <summary>
+	/// PeekŌ͂̂Ă
+	/// </summary>
+	virtual void Pop();
+
+	/// <summary>
+	/// ȂĂ邩ǂ
+	/// </summary>
+	/// <returns>ȂĂtrue</returns>
+	virtual bool IsConnected() const;
+
+private:
+
+	// pbh̔ԍ
+	int _pad;
+
+	// DxLibœǂ񂾓
+	PadSample _sample;
+
+	// DxLibœǂ񂾓͂܂oĂȂǂ
+	bool _hasSample;
+
+	// DxLibœǂ񂾂ƂɂȂĂǂ
+	bool _isConnected;
+};
@@ -0,0 +1,71 @@
+#pragma once
+#include <vector>
+
+struct ID3D11Query;
+
+// GPU1t[̕`ɂԂAD3D11̃^CX^ṽNGőNX
+// ʂ͐t[xē͂̂ŁA͂ňԐV̂Ԃ
+// (Direct3D11gĂȂƂ͑Ȃ)
+class GpuTimer
+{
+public:
+
+	/// <summary>
+	/// RXgN^
+	/// DxLib_Iniťɍ
+	/// </summary>
+	GpuTimer();
+
+	/// <summary>
+	/// fXgN^
+	/// </summary>
+	virtual ~GpuTimer();
+
+	/// <summary>
+	/// t[̕`̍ŏɌĂ
+	/// </summary>
+	void Begin();
+
+	/// <summary>
+	/// t[̕`̍ŌɌĂ(RenderVertexŗ܂Ă`o)
+	/// </summary>
+	void End();
+
+	/// <summary>
+	/// ͂ňԐVt[GPU̕`掞ԂԂ
+	/// </summary>
+	/// <returns>GPU̕`掞(}CNbA܂ĂȂ-1)</returns>
+	long long GetTime() const;
+
+private:
+
+	/// <summary>
+	/// ʂ͂NGǂ
+	/// </summary>
+	void Collect();
+
+	/// <summary>
+	/// NG(ȍ~͑Ȃ)
+	/// </summary>
+	void Release();
+
+	// 1t[̃NG
+	struct Frame {
+		ID3D11Query* disjoint = nullptr;	// vGPŨNbNςȂ
+		ID3D11Query* begin = nullptr;		// `̍ŏ̎
+		ID3D11Query* end = nullptr;			// `̍Ō̎
+		bool isPending = false;				// ʂ҂Ă邩ǂ
+	};
+
+	// ʂ҂Ԃ̃t[𑪂悤At[Ɏg
+	std::vector<Frame> _frame;
+
+	// Ɏg_framëʒu
+	int _frameIndex;
+
+	// BeginŌvn߂ǂ
+	bool _isBegun;
+
+	// ͂ňԐVGPU̕`掞(}CNb)
+	long long _time;
+};
@@ -1,7 +1,9 @@
 #pragma once
 #include <array>
+#include <memory>
 #include "DxLib.h"
 #include "Singleton.h"
+#include "Constant.h"
 #include "Vec3.h"
 
 // epbh
@@ -43,16 +45,75 @@
 //	 short		ThumbRY;	// EXeBbN̏cl( -32768 ` 32767 )
 // };
 
+// pbh1̓
+// {^XInput̃{^̃rbgƁAgK[Ă邩ǂ̃rbg(PAD_LEFT_TRIGGER_BITȂ)Ŏ
+struct PadState
+{
+	unsigned int down;			// Ă{^
+	unsigned int trigger;		// uԂ̃{^
+	unsigned int hold;			// ÕeBbN牟Ă{^
+	unsigned int release;		// uԂ̃{^
+	unsigned char leftTrigger;	// gK[(0`255)
+	unsigned char rightTrigger;	// EgK[(0`255)
+	short thumbLX;				// XeBbN̉(-32768`32767)
+	short thumbLY;				// XeBbN̏c
+	short thumbRX;				// EXeBbN̉
+	short thumbRY;				// EXeBbN̏c
+};
+
+class InputDevice;
+
 // Cvbg񋟂VOgNX
-class Input : public Singleton<Input>
+// uԂȂǂ̃{^̃rbǵAUpdateŃpbhƂɂ܂Ƃ߂ċ߂Ă
+// pbh̔ԍƂɓ͑u(XInput̃pbhEL[{[hƃ}EXEXNvg̉z̃pbh)蓖Ăēǂ
+class Input :
+	public Singleton<Input>,
+	public Constant
 {
 	friend class Singleton<Input>;
 
 public:
+	/// <summary>
+	/// (萔t@Cɏ]ăpbh̔ԍƂɓ͑u蓖Ă)
+	/// </summary>
+	void Init();
+
+	/// <summary>
+	/// pbh̔ԍɓ͑u蓖Ă
+	/// </summary>
+	/// <param name="padNum">pbhio[</param>
+	/// <param name="device">͑u(nullptrȂ犄蓖ĂO)</param>
+	void SetDevice(int padNum, std::shared_ptr<InputDevice> device);
+
+	/// <summary>
+	/// pbh̔ԍɁAXNvgĐ鉼z̃pbh蓖Ă
+	/// </summary>
+	/// <param name="padNum">pbhio[</param>
+	void SetScriptDevice(int padNum);
+
+	/// <summary>
+	/// ŏ͂鑕u߂ɖ߂Ãpbh̑O̓͂̂Ă
+	/// (̏߂ɌĂсAXNvgœ𖈉񓯂͂n߂)
+	/// </summary>
+	void RestartDevices();
+
+	/// <summary>
+	/// ̃eBbN̓͂Ń}EXD(ʂ̒Sɖ߂ĉEXeBbNɂ)
+	/// vC[𓮂ĂԂeBbNĂ(Ă΂Ȃ΃j[ȂǂŃ}EXDȂ)
+	/// </summary>
+	void CaptureMouse();
+
+	/// <summary>
+	/// ̃eBbN̓͂Ń}EXDǂ
+	/// </summary>
+	/// <returns>DȂtrue</returns>
+	bool IsMouseCaptured() const;
+
 	/// <summary>
 	/// XV
 	/// </summary>
-	void Update();
+	/// <param name="tickTime">̃eBbN̏I̎(InputSampler::GetTime̒lA͎̓͂̃eBbNŎg)</param>
+	void Update(long long tickTime);
 
 	/// <summary>
 	/// uԂƂ
@@ -126,23 +187,59 @@ public:
 	/// <returns>XeBbNXĂxNgY̒l</returns>
 	float GetStickThumbY(int input, int padNum) const;
 
+	/// <summary>
+	/// pbh̍̃eBbN̓͂܂Ƃ߂Ď擾(͂̋L^p)
+	/// </summary>
+	/// <param name="padNum">pbhio[</param>
+	/// <returns>pbh̓</returns>
+	const PadState& GetPadState(int padNum) const;
+
+	/// <summary>
+	/// {^Ōɉ擾(͂̒x̌vp)
+	/// </summary>
+	/// <param name="input">{^</param>
+	/// <param name="padNum">pbhio[</param>
+	/// <returns>(InputSampler::GetTime̒lAƂȂ-1)</returns>
+	long long GetPressTime(int input, int padNum) const;
+
 	/// <summary>
 	/// ڑĂRg[[̐擾
+	/// (ȂĂ͑ûAԑ傫pbh̔ԍ+1)
 	/// </summary>
 	/// <returns>Rg[[̐</returns>
 	int GetPadNum();
 
 private:
-	// t[̃CvbgXe[g
-	XINPUT_STATE _padState[4] = {};
+	// pbh̔ԍƂ̓͑u
+	std::shared_ptr<InputDevice> _device[4];
+
+	// ̃eBbÑCvbgXe[g
+	PadState _padState[4] = {};
 
-	// Ot[̃CvbgXe[g
-	XINPUT_STATE _lastPadState[4] = {};
+	// {^̃rbgƂ́AŌɉ(ƂȂ0)
+	long long _pressTime[4][32] = {};
+
+	/// <summary>
+	/// {^̉o
+	/// </summary>
+	/// <param name="padNum">pbhio[</param>
+	/// <param name="pressed">{^̃rbg</param>
+	/// <param name="time"></param>
+	void SetPressTime(int padNum, unsigned int pressed, long long time);
 
 	// vCx[gRXgN^
-	Input() {};
+	Input();
+
+	// fXgN^
+	~Input();
 
 	// ڑĂRg[[̐
 	int _padNum = 0;
+
+	// ̃eBbNŃ}EXD
+	bool _isMouseCaptureRequested = false;
+
+	// ̃eBbNŃ}EXD
+	bool _isMouseCaptured = false;
 };
 
@@ -0,0 +1,52 @@
+#pragma once
+#include "InputSampler.h"
+
+// pbh̔ԍƂɊ蓖Ă͑u̎(Input.csvDEVICE_PAD_1Ȃǂ̒l)
+constexpr int INPUT_DEVICE_NONE = 0;		// 蓖ĂȂ
+constexpr int INPUT_DEVICE_GAMEPAD = 1;		// XInput̃pbh
+constexpr int INPUT_DEVICE_KEYBOARD = 2;	// L[{[hƃ}EX
+constexpr int INPUT_DEVICE_SCRIPT = 3;		// XNvgœz̃pbh
+
+// Input̃pbh1̓͂鑕ůNX
+// ͂PadSamplě`ŁAÂ1o
+// InputCXbhŁAeBbNƂUpdatePeekEPop̏ɌĂ
+class InputDevice
+{
+public:
+
+	/// <summary>
+	/// fXgN^
+	/// </summary>
+	virtual ~InputDevice() {}
+
+	/// <summary>
+	/// eBbN̍ŏɌĂ΂XV(t[Ƃɓǂޑu͂œǂ)
+	/// </summary>
+	/// <param name="tickTime">̃eBbN̏I̎(InputSampler::GetTime̒l)</param>
+	virtual void Update(long long) {}
+
+	/// <summary>
+	/// ܂oĂȂ͂̐擪oɌ
+	/// </summary>
+	/// <param name="tickTime">̃eBbN̏I̎(̓͂͌Ȃ)</param>
+	/// <param name="sample">擪̓͂󂯎ϐ</param>
+	/// <returns>̃eBbN̓͂cĂȂfalse</returns>
+	virtual bool Peek(long long tickTime, PadSample& sample) = 0;
+
+	/// <summary>
+	/// PeekŌ͂̂Ă
+	/// </summary>
+	virtual void Pop() = 0;
+
+	/// <summary>
+	/// ȂĂ邩ǂ
+	/// </summary>
+	/// <returns>ȂĂtrue</returns>
+	virtual bool IsConnected() const = 0;
+
+	/// <summary>
+	/// ŏ͂鑕u(XNvgȂ)߂ɖ߂
+	/// </summary>
+	/// <returns>߂ɖ߂true(Input͑O̓͂̂Ă)</returns>
+	virtual bool Restart() { return false; }
+};
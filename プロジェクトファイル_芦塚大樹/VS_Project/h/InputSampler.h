@@ -0,0 +1,122 @@
+#pragma once
+#include "Singleton.h"
+#include "Constant.h"
+#include "SpscQueue.h"
+#include <atomic>
+#include <thread>
+
+// pbh̍ő吔
+constexpr int MAX_PAD_NUM = 4;
+
+// {^̃rbg̊OɒuAgK[Ă邩ǂ̃rbg
+constexpr unsigned int PAD_LEFT_TRIGGER_BIT = 1u << 16;
+constexpr unsigned int PAD_RIGHT_TRIGGER_BIT = 1u << 17;
+
+// pbh̓͂ǂݎ1
+struct PadSample
+{
+	long long time;				// ǂݎ(InputSampler::GetTime̒l)
+	unsigned int buttons;		// Ă{^(XInput̃{^̃rbgƃgK[̃rbg)
+	unsigned char leftTrigger;	// gK[(0`255)
+	unsigned char rightTrigger;	// EgK[(0`255)
+	short thumbLX;				// XeBbN̉(-32768`32767)
+	short thumbLY;				// XeBbN̏c
+	short thumbRX;				// EXeBbN̉
+	short thumbRY;				// EXeBbN̏c
+};
+
+// pbh̓͂p̃XbhŒZԊuœǂݎAςƂpbhƂ̃L[ɐςރVOgNX
+// t[̍ŏ1ǂނƁAǂ񂾒̓͂1t[҂AǂފԂɉė͎͂肱ڂ
+// L[InputeBbNƂɎo
+// XInput̃pbhǂ(XInput̓XbhZ[tADxLib̓͊֐͕ʂ̃XbhĂׂȂ)
+class InputSampler :
+	public Singleton<InputSampler>,
+	public Constant
+{
+	friend class Singleton<InputSampler>;
+
+public:
+
+	/// <summary>
+	/// (ǂݎp̃Xbh𗧂Ă)
+	/// </summary>
+	void Init();
+
+	/// <summary>
+	/// I(ǂݎp̃Xbh~߂)
+	/// </summary>
+	void Terminate();
+
+	/// <summary>
+	/// ǂݎp̃Xbhœ͂ǂł邩ǂ
+	/// (ǂłȂInputDxLibŃt[Ƃɓǂ)
+	/// </summary>
+	/// <returns>ǂłtrue</returns>
+	bool IsRunning() const;
+
+	/// <summary>
+	/// pbhȂĂ邩ǂ
+	/// </summary>
+	/// <param name="pad">pbh̔ԍ</param>
+	/// <returns>Ōɓǂ񂾂ƂɂȂĂtrue</returns>
+	bool IsConnected(int pad) const;
+
+	/// <summary>
+	/// pbh̃L[̐擪oɌ(CXbhŌĂ)
+	/// </summary>
+	/// <param name="pad">pbh̔ԍ</param>
+	/// <param name="sample">擪̓͂󂯎ϐ</param>
+	/// <returns>L[Ȃfalse</returns>
+	bool Peek(int pad, PadSample& sample) const;
+
+	/// <summary>
+	/// pbh̃L[̐擪̂Ă(CXbhŌĂ)
+	/// </summary>
+	/// <param name="pad">pbh̔ԍ</param>
+	void Pop(int pad);
+
+	/// <summary>
+	/// ͂̎Ɏg̎擾
+	/// </summary>
+	/// <returns>(}CNb)</returns>
+	static long long GetTime();
+
+private:
+
+	// vCx[gRXgN^
+	InputSampler();
+
+	// fXgN^
+	~InputSampler();
+
+	/// <summary>
+	/// ǂݎp̃Xbh̏
+	/// </summary>
+	void SampleLoop();
+
+	/// <summary>
+	/// pbh̍̓͂ǂ
+	/// </summary>
+	/// <param name="pad">pbh̔ԍ</param>
+	/// <param name="sample">ǂ񂾓͂󂯎ϐ</param>
+	/// <returns>ڑĂȂfalse</returns>
+	static bool ReadPad(int pad, PadSample& sample);
+
+	// pbhƂ́Aς͂̃L[
+	SpscQueue<PadSample, 256> _queue[MAX_PAD_NUM];
+
+	// pbhƂ́AŌɐς񂾓
+	PadSample _lastSample[MAX_PAD_NUM];
+
+	// pbhƂ́AȂĂȂpbhɓǂނ܂ł̉
+	int _retryCount[MAX_PAD_NUM];
+
+	// pbhƂ́AȂĂ邩ǂ
+	std::atomic<bool> _isConnected[MAX_PAD_NUM];
+
+	// ǂݎp̃Xbh
+	std::thread _thread;
+
+	// XbhItO
+	std::atomic<bool> _isExit;
+};
@@ -28,6 +28,11 @@ public:
 
 	void Draw() const;
 
+	/// <summary>
+	/// ׂẴACe폜AƂԊu𐔂(Đp)
+	/// </summary>
+	void Reset();
+
 
 private:
 
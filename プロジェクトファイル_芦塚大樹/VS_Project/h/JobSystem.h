@@ -0,0 +1,137 @@
+#pragma once
+#include "Singleton.h"
+#include "Constant.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// ς񂾎d̎c̐𐔂JE^[
+// RunŐςނтɑAdI邽тɌ(0ɂȂSI)
+struct JobCounter
+{
+	std::atomic<int> count = 0;
+};
+
+// Q[̍XVׂ̍d𕡐̃XbhŕčsVOgNX
+// XbhƂɎd̗A̗͌납A󂢂瑼̃Xbh̗̑O瓐
+// I҂Xbh(CXbh)A҂ĂԂ͎ds
+// DxLibEEffekseer̊֐̓CXbhłĂׂȂ̂ŁAd̒ł͌vZs
+class JobSystem :
+	public Singleton<JobSystem>,
+	public Constant
+{
+	friend class Singleton<JobSystem>;
+
+public:
+
+	/// <summary>
+	/// (dsXbh𗧂Ă)
+	/// </summary>
+	void Init();
+
+	/// <summary>
+	/// I(dsXbh~߂)
+	/// </summary>
+	void Terminate();
+
+	/// <summary>
+	/// dsXbh̐ςėĒ(RA̐Ɋ֌WȂXbhɕĎƂɎg)
+	/// ς񂾎dׂďIĂƂɌĂ
+	/// </summary>
+	/// <param name="workerNum">dsXbh̐(0Ȃ烁CXbh)</param>
+	void SetWorkerNum(int workerNum);
+
+	/// <summary>
+	/// Ă񂾃Xbh̗Ɏdς
+	/// </summary>
+	/// <param name="job">s</param>
+	/// <param name="counter">I猸炷JE^[</param>
+	void Run(std::function<void()> job, JobCounter& counter);
+
+	/// <summary>
+	/// JE^[0ɂȂ܂ŁAd`Ȃ҂
+	/// </summary>
+	/// <param name="counter">҂JE^[</param>
+	void Wait(JobCounter& counter);
+
+	/// <summary>
+	/// 0`count-1̔ԍɂďs
+	/// ԍgrainɕĐς݁ASI܂ő҂
+	/// </summary>
+	/// <param name="count">ԍ̐</param>
+	/// <param name="grain">1̎dōsԍ̐(ƐςގԂ̕)</param>
+	/// <param name="func">ԍƂ̏(ɌĂ΂̂ŁAԍƂɕʂ̏ꏊɏނ)</param>
+	void ParallelFor(int count, int grain, const std::function<void(int)>& func);
+
+	/// <summary>
+	/// XbhƂ̍sdƓ񂾎d̐Ot@Cɏo͂
+	/// </summary>
+	void Report() const;
+
+private:
+
+	// vCx[gRXgN^
+	JobSystem();
+
+	// fXgN^
+	~JobSystem();
+
+	// ς܂ꂽd
+	struct Job {
+		std::function<void()> func;
+		JobCounter* counter;
+	};
+
+	// XbhƂ̎d̗(0Ԃ̓CXbh)
+	struct Queue {
+		std::deque<Job> job;
+		std::mutex mutex;
+		std::atomic<int> executedNum = 0;	// sd̐
+		std::atomic<int> stolenNum = 0;		// ̗񂩂瓐񂾎d̐
+	};
+
+	/// <summary>
+	/// dsXbhƂ̗
+	/// </summary>
+	/// <param name="workerNum">dsXbh̐</param>
+	void StartWorker(int workerNum);
+
+	/// <summary>
+	/// dsXbh̏
+	/// </summary>
+	/// <param name="index">Xbh̔ԍ</param>
+	void WorkerLoop(int index);
+
+	/// <summary>
+	/// ̗񂩑̗񂩂d1čs
+	/// </summary>
+	/// <param name="index">Ă񂾃Xbh̔ԍ</param>
+	/// <returns>dstrue</returns>
+	bool RunOne(int index);
+
+	/// <summary>
+	/// Ă񂾃Xbh̔ԍ擾(dsXbhȊO0)
+	/// </summary>
+	int GetIndex() const;
+
+	// XbhƂ̎d̗
+	std::vector<std::unique_ptr<Queue>> _queue;
+
+	// dsXbh
+	std::vector<std::thread> _worker;
+
+	// ɐς܂Ăd̐
+	std::atomic<int> _queuedNum;
+
+	// dȂXbh𖰂点
+	std::mutex _sleepMutex;
+	std::condition_variable _sleepCondition;
+
+	// XbhItO
+	std::atomic<bool> _isExit;
+};
@@ -0,0 +1,67 @@
+#pragma once
+#include "InputDevice.h"
+
+// L[{[hƃ}EXpbhɌĂ͑u
+// WASDōXeBbNAL[}EẌړŉEXeBbNA}EX̍{^ŉEgK[
+// }EX̓vC[𓮂ĂԂD(Input::CaptureMouse)
+// DxLib̓͊֐ĝŁAeBbNƂɃCXbhœǂ
+class KeyboardDevice :
+	public InputDevice
+{
+public:
+
+	/// <summary>
+	/// RXgN^
+	/// </summary>
+	/// <param name="mouseScale">}EX1sNZƂ̉EXeBbŇX(0Ȃ}EXŉEXeBbN𓮂Ȃ)</param>
+	KeyboardDevice(float mouseScale);
+
+	/// <summary>
+	/// fXgN^
+	/// </summary>
+	virtual ~KeyboardDevice();
+
+	/// <summary>
+	/// XV(L[{[hƃ}EXǂ)
+	/// </summary>
+	/// <param name="tickTime">̃eBbN̏I̎</param>
+	virtual void Update(long long tickTime);
+
+	/// <summary>
+	/// ̃eBbNœǂ񂾓͂oɌ
+	/// </summary>
+	/// <param name="tickTime">̃eBbN̏I̎</param>
+	/// <param name="sample">ǂ񂾓͂󂯎ϐ</param>
+	/// <returns>oς݂Ȃfalse</returns>
+	virtual bool Peek(long long tickTime, PadSample& sample);
+
+	/// <summary>
+	/// PeekŌ͂̂Ă
+	/// </summary>
+	virtual void Pop();
+
+	/// <summary>
+	/// ȂĂ邩ǂ(L[{[h͏ɂȂĂƂ݂Ȃ)
+	/// </summary>
+	/// <returns>true</returns>
+	virtual bool IsConnected() const;
+
+private:
+
+	/// <summary>
+	/// 2̃L[̉XeBbN̎̒l߂
+	/// </summary>
+	/// <param name="negative">}CiX̃L[</param>
+	/// <param name="positive">vX̃L[</param>
+	/// <returns>XeBbN̎̒l</returns>
+	static short GetKeyAxis(int negative, int positive);
+
+	// }EX1sNZƂ̉EXeBbŇX
+	float _mouseScale;
+
+	// ̃eBbNœǂ񂾓
+	PadSample _sample;
+
+	// ǂ񂾓͂܂oĂȂǂ
+	bool _hasSample;
+};
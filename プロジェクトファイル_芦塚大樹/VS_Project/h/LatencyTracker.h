@@ -0,0 +1,119 @@
+#pragma once
+#include "Singleton.h"
+#include "Constant.h"
+#include <string>
+#include <vector>
+
+// ͂ʂɏo܂ł̒iK
+enum class LatencyStage
+{
+	Input,		// {^(InputSamplerǂ񂾎)
+	Trigger,	// vC[eƌ߂
+	Spawn,		// e𐶐
+	Effect,		// ẽGtFNgĐ
+	Draw,		// e`悷t[̕`n߂
+	Flip,		// ̃t[ScreenFlipI
+	Num,
+};
+
+// {^Ăeʂɏo܂ł̎ԂAe̎ނƂɑVOgNX
+// ƂɋL^n߁Ae̐ƃGtFNg̍Đ́űL^vɈtA`ScreenFlipŋL^I
+// IL^̓qXgOɂ܂Ƃ߂ĉʂɕ\A1CSVɏo
+// ׂ͂InputSampler::GetTime̒lŁACXbh炾Ă
+class LatencyTracker :
+	public Singleton<LatencyTracker>,
+	public Constant
+{
+	friend class Singleton<LatencyTracker>;
+
+public:
+
+	/// <summary>
+	/// L^n߂
+	/// {^܂܂̘A˂́AĂŏ1L^
+	/// </summary>
+	/// <param name="action">e̎</param>
+	/// <param name="padNum">pbhio[</param>
+	/// <param name="inputTime">{^(ȂL^Ȃ)</param>
+	/// <param name="triggerTime">ƌ߂</param>
+	/// <returns>L^̔ԍ(L^Ȃ-1)</returns>
+	int Begin(int action, int padNum, long long inputTime, long long triggerTime);
+
+	/// <summary>
+	/// ȍ~MarkňtL^ݒ肷
+	/// </summary>
+	/// <param name="id">L^̔ԍ(-1ŕtȂ)</param>
+	void SetCurrent(int id);
+
+	/// <summary>
+	/// ̋L^ɁA̒iKɗt(tĂΉȂ)
+	/// </summary>
+	/// <param name="stage">iK</param>
+	void Mark(LatencyStage stage);
+
+	/// <summary>
+	/// t[̕`n߂ƂɌĂ
+	/// </summary>
+	void OnDraw();
+
+	/// <summary>
+	/// ScreenFlip̌ɌĂ
+	/// </summary>
+	void OnFlip();
+
+	/// <summary>
+	/// e̎ނƂ̃qXgOʂɕ`悷
+	/// </summary>
+	void DrawOverlay() const;
+
+	/// <summary>
+	/// IL^CSVɏo
+	/// </summary>
+	/// <param name="path">ot@C̃pX</param>
+	void Export(const std::string& path) const;
+
+private:
+
+	// vCx[gRXgN^
+	LatencyTracker();
+
+	// L^
+	struct Record {
+		int id = -1;
+		int action = 0;
+		long long time[static_cast<int>(LatencyStage::Num)] = {};	// iKƂ̎(܂ĂȂ-1)
+	};
+
+	// e̎ނƂ̂܂Ƃ
+	struct Summary {
+		std::vector<int> bucket;	// BUCKET_WIDTHƂ̌(Ō͔͈͂𒴂ׂ̂)
+		int count = 0;
+		long long max = 0;
+	};
+
+	/// <summary>
+	/// qXgOp[Z^C߂
+	/// </summary>
+	/// <param name="summary">e̎ނƂ̂܂Ƃ</param>
+	/// <param name="rate">0.0`1.0</param>
+	/// <returns>(}CNbA̋Ԃ̏)</returns>
+	long long GetPercentile(const Summary& summary, float rate) const;
+
+	// ʂɏô҂ĂL^
+	std::vector<Record> _pending;
+
+	// IL^(CSVp)
+	std::vector<Record> _done;
+
+	// e̎ނƂ̂܂Ƃ
+	std::vector<Summary> _summary;
+
+	// pbhƒe̎ނƂ́AŌɋL^{^
+	std::vector<long long> _lastInput;
+
+	// ̋L^̔ԍ
+	int _current;
+
+	// ɐUL^̔ԍ
+	int _nextId;
+};
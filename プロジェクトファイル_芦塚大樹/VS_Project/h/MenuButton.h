@@ -1,6 +1,8 @@
 #pragma once
 #include "Vec2.h"
 
+class SpriteBatch;
+
 class MenuButton
 {
 public:
@@ -24,10 +26,12 @@ public:
 	void Update();
 
 	/// <summary>
-	/// `揈
+	/// `eob`ɋL^
 	/// </summary>
+	/// <param name="batch">L^̃ob`</param>
 	/// <param name="margin">]</param>
-	void Draw(int margin) const;
+	/// <param name="layer">`揇</param>
+	void Record(SpriteBatch& batch, int margin, int layer) const;
 
 	/// <summary>
 	/// 蔻͈͂擾
@@ -2,6 +2,7 @@
 #include <memory>
 #include "Vec2.h"
 #include "Constant.h"
+#include "SpriteBatch.h"
 
 #define BATU_BUTTON 0
 #define MANUAL_BUTTON 1
@@ -84,6 +85,11 @@ private:
 
 	void EndDraw() const;
 
+	/// <summary>
+	/// wiAՁA{^ob`ɋL^
+	/// </summary>
+	void Record();
+
 	// j[̊Չ摜
 	int _menuBordHandle;
 
@@ -111,5 +117,14 @@ private:
 	// ʒ߉摜nhz
 	int _volumeSEGraph[4];
 	int _volumeBGMGraph[4];
+
+	// wiAՁA{^܂Ƃ߂ob`
+	SpriteBatch _batch;
+
+	// ob`ɋL^Ƃ̗]
+	int _recordMargin = 0;
+
+	// {^̉摜ςċL^Kv邩
+	bool _isRecordDirty = true;
 };
 
@@ -0,0 +1,64 @@
+#pragma once
+#include "Singleton.h"
+#include <map>
+#include <string>
+
+// 3Dfxǂݍ݁AzVOgNX
+// f͕̎QƂȂȂĂcĂAV[؂ւɂ܂Ƃ߂ĉ
+class ModelManager :
+	public Singleton<ModelManager>
+{
+	friend class Singleton<ModelManager>;
+
+public:
+
+	/// <summary>
+	/// f̕擾
+	/// f܂ǂݍ܂ĂȂΓǂݍ
+	/// </summary>
+	/// <param name="path">ft@C̃pX</param>
+	/// <returns>fnh</returns>
+	int Duplicate(const std::string& path);
+
+	/// <summary>
+	/// f񓯊Őǂ݂Ă
+	/// DuplicateŎg܂ł͎QƐ0̂܂ܕێ
+	/// </summary>
+	/// <param name="path">ft@C̃pX</param>
+	/// <returns>ǂݍݒ̌f̃nh(̊mFp)</returns>
+	int Preload(const std::string& path);
+
+	/// <summary>
+	/// f폜
+	/// ǗĂȂnh͂̂܂܍폜
+	/// </summary>
+	/// <param name="handle">fnh</param>
+	void Release(int handle);
+
+	/// <summary>
+	/// cĂȂf폜
+	/// </summary>
+	void ReleaseUnused();
+
+	/// <summary>
+	/// ǂݍł郂fƎgp̖ڈOt@Cɏo͂
+	/// </summary>
+	void Report() const;
+
+private:
+
+	// vCx[gRXgN^
+	ModelManager() {};
+
+	// f̏
+	struct Source {
+		int handle;			// f̃nh
+		int refCount;		// zĂ镡̐
+	};
+
+	// pXƂ̌f
+	std::map<std::string, Source> _source;
+
+	// nhƂ̌f̃pX
+	std::map<int, std::string> _instance;
+};
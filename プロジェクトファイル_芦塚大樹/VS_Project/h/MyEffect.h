@@ -1,11 +1,19 @@
 #pragma once
 #include "Vec3.h"
 
+// EffectManager̍ĐgōĐĂGtFNg𑀍삷NX
+// ԍȂ̂Œl̂܂܃oɎARs[Ă悢
+// ĐÎŎ~߂ꂽ̂𑀍삵ĂNȂ
 class MyEffect
 {
 public:
 	/// <summary>
-	/// RXgN^
+	/// RXgN^(ĐȂ)
+	/// </summary>
+	MyEffect();
+
+	/// <summary>
+	/// RXgN^(GtFNgĐ)
 	/// </summary>
 	/// <param name="effect">GtFNgL[</param>
 	/// <param name="pos">ʒu</param>
@@ -41,7 +49,7 @@ public:
 
 private:
 
-	// vCnh
-	int _playHandle;
+	// EffectManagerōĐĂGtFNg̔ԍ
+	int _instance;
 };
 
@@ -1,8 +1,8 @@
 #pragma once
 #include <memory>
 #include "BulletBase.h"
+#include "MyEffect.h"
 
-class MyEffect;
 class BulletManager;
 class MapBulletCollisionManager;
 class NormalBullet :
@@ -56,7 +56,7 @@ private:
 	int _frame;
 
 	// ubNjGtFNg
-	std::shared_ptr<MyEffect> _destroyEffect;
+	MyEffect _destroyEffect;
 
 };
 
@@ -1,5 +1,6 @@
 #pragma once
 #include "Vec2.h"
+#include "SpriteBatch.h"
 
 #define NUM_0 0
 #define NUM_1 1
@@ -25,10 +26,20 @@ public:
 
 	void Update(int time);
 
+	/// <summary>
+	/// \āA̍XVŋL^
+	/// </summary>
+	void Reset();
+
 	void Draw() const;
 
 private:
 
+	/// <summary>
+	/// \鐔̕тob`ɋL^
+	/// </summary>
+	void Record();
+
 	// 摜nh
 	int _numHandle[11];
 
@@ -39,5 +50,11 @@ private:
 	Vec2 _drawPos;
 
 	float _size;
+
+	// L^Ă鎞(ςƂL^)
+	int _time;
+
+	// ̕`܂Ƃ߂ob`
+	SpriteBatch _batch;
 };
 
@@ -3,9 +3,10 @@
 #include <memory>
 #include "Constant.h"
 #include "Vec2.h"
+#include "MyEffect.h"
+#include "CommandBuffer.h"
 #include "PlayerManager.h"
 
-class MyEffect;
 class BulletManager;
 class PlayerCamera;
 class Player:
@@ -96,6 +97,29 @@ public:
 
 	void GiveItem(int itemType);
 
+	/// <summary>
+	/// AIǂ
+	/// </summary>
+	/// <returns>AIȂtrue</returns>
+	bool IsAi() const;
+
+	/// <summary>
+	/// Jn̏Ԃɖ߂(fJ͍蒼Ȃ)
+	/// Wƌ̓vC[}l[W[ݒ肵
+	/// </summary>
+	void Reset();
+
+	/// <summary>
+	/// ȍ~DxLibEGtFNgETEhEe̐ȂǂAExecuteDeferred܂ŗ߂
+	/// ʂ̃XbhControlEUpdatesOɌĂ
+	/// </summary>
+	void BeginDefer();
+
+	/// <summary>
+	/// ߂s(CXbhŁAvC[̏ԂɌĂ)
+	/// </summary>
+	void ExecuteDeferred();
+
 private:
 
 	// Rg[֐|C^
@@ -153,6 +177,13 @@ private:
 	/// <param name="bullet">e̎</param>
 	void BulletTrigger(int bullet);
 
+	/// <summary>
+	/// ˉ炵Ēe𐶐
+	/// </summary>
+	/// <param name="bullet">e̎</param>
+	/// <param name="se">ˉ</param>
+	void Shoot(int bullet, int se);
+
 	// Ÿړ
 	float _moveScaleY;
 
@@ -202,7 +233,7 @@ private:
 	Vec3 _oldPos;
 
 	// GtFNg
-	std::shared_ptr<MyEffect> _pEffect;
+	MyEffect _effect;
 
 	// X^tO
 	bool _stunFrag;
@@ -215,5 +246,8 @@ private:
 
 	// Xs[hAbvt[
 	int _speedUpFrame;
+
+	// CXbhōs
+	CommandBuffer _command;
 };
 
@@ -1,8 +1,10 @@
 #pragma once
 #include <memory>
+#include <vector>
 #include "Vec3.h"
 
 class BulletManager;
+class BulletBase;
 class PlayerManager;
 class PlayerBulletCollisionManager
 {
@@ -53,6 +55,12 @@ private:
 	// vC[}l[W[̎Q
 	std::shared_ptr<PlayerManager>& _pPlayerManager;
 
+	// se(Xgԍň悤ɕג)
+	std::vector<std::shared_ptr<BulletBase>> _bullet;
+
+	// vC[ƒȇgƂ̔茋(vC[̔ԍ*e̐+e̔ԍ)
+	// (vector<bool>͓ɏ߂Ȃ̂charŎ)
+	std::vector<char> _hit;
 
 };
 
@@ -35,6 +35,23 @@ public:
 	/// <returns>^[Qbg̍W</returns>
 	Vec3 GetTarget();
 
+	/// <summary>
+	/// `ɎgJ̍W擾(ÕeBbNƂ̕)
+	/// </summary>
+	/// <returns>J̍W</returns>
+	Vec3 GetDrawPosition() const;
+
+	/// <summary>
+	/// `Ɏg^[Qbg̍W擾(ÕeBbNƂ̕)
+	/// </summary>
+	/// <returns>^[Qbg̍W</returns>
+	Vec3 GetDrawTarget() const;
+
+	/// <summary>
+	/// ]ƕԂ߂ɂ(̍XV߂Ă̍XVƂĈ)
+	/// </summary>
+	void Reset();
+
 
 private:
 
@@ -56,6 +73,13 @@ private:
 
 	Vec3 _target;
 
+	// ÕeBbÑJƃ^[Qbg̍W
+	Vec3 _prevPosition;
+	Vec3 _prevTarget;
+
+	// xłXV
+	bool _isUpdated = false;
+
 	// J甭郉Cgnh
 	int _lightHandle;
 
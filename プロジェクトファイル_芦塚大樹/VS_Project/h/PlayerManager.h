@@ -3,6 +3,7 @@
 #include <vector>
 #include "Constant.h"
 #include "BulletManager.h"
+#include "MyEffect.h"
 
 constexpr int PLAYER_ONE = 0;
 constexpr int PLAYER_TWO = 1;
@@ -49,7 +50,6 @@ struct BulletData
 
 };
 
-class MyEffect;
 class PlayerUi;
 class StageManager;
 class CollisionManager;
@@ -84,6 +84,20 @@ public:
 	/// <param name="num">vC[io[</param>
 	void Draw(int num) const;
 
+	/// <summary>
+	/// vC[`悷(UIDrawUiŕ`悷)
+	/// </summary>
+	void DrawPlayer() const;
+
+	/// <summary>
+	/// vC[̉ʂUI`悷
+	/// 𑜓x𗎂ƂXN[ɕ`Ƃ̂ŁAʂɈL΂ɕ`悷
+	/// </summary>
+	/// <param name="num">vC[io[</param>
+	/// <param name="x">ʂ̍XW</param>
+	/// <param name="y">ʂ̍YW</param>
+	void DrawUi(int num, int x, int y) const;
+
 	/// <summary>
 	/// `͈͂擾
 	/// </summary>
@@ -157,8 +171,24 @@ public:
 
 	std::vector<std::shared_ptr<Player>>& GetPlayerList();
 
+	/// <summary>
+	/// vC[ʒuɖ߂AsȂ(Đp)
+	/// </summary>
+	void Reset();
+
 private:
 
+	/// <summary>
+	/// vC[̐CX^XAʒuɒu
+	/// </summary>
+	void CreatePlayer();
+
+	/// <summary>
+	/// vC[ԍƂ̏ʒuƌɒu
+	/// </summary>
+	/// <param name="num">vC[̔ԍ</param>
+	void PlaceStart(int num);
+
 	/// <summary>
 	/// vC[`͈͂߂
 	/// </summary>
@@ -190,9 +220,6 @@ private:
 	// vC[̐ɑΉJ̃Z^[
 	VECTOR2 _cameraSenter;
 
-	// vC[̐̑Ήfnh
-	int _modelHandle[4];
-
 	// vC[Ƃ̒ẽf[^
 	BulletData _bulletData[4];
 
@@ -207,10 +234,10 @@ private:
 	std::shared_ptr<BulletManager>& _bulletManager;
 
 	// GtFNg
-	std::shared_ptr<MyEffect> _pWinEffect;
+	MyEffect _winEffect;
 
 	// ăGtFNg
-	std::shared_ptr<MyEffect> _pShotOutEffect;
+	MyEffect _shotOutEffect;
 
 	// t[JE^
 	int _frame;
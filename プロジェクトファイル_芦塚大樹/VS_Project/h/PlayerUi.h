@@ -1,5 +1,7 @@
 #pragma once
+#include <vector>
 #include "Vec2.h"
+#include "SpriteBatch.h"
 #include "PlayerManager.h"
 
 class PlayerUi
@@ -22,13 +24,36 @@ public:
 	/// </summary>
 	void Update();
 
+	/// <summary>
+	/// g嗦̃Aj[VƋL^UI߂ɂ
+	/// </summary>
+	void Reset();
+
 	/// <summary>
 	/// `揈
 	/// </summary>
 	/// <param name="center">`̒SW</param>
-	void Draw(Vec2 center, BulletData data) const;
+	/// <param name="data">ȇIƃN[^C</param>
+	/// <param name="viewNum">`悷ʂ̔ԍ(ʂƂɋL^)</param>
+	void Draw(Vec2 center, BulletData data, int viewNum = 0) const;
 private:
 
+	// ʂƂɋL^UI
+	struct Record {
+		SpriteBatch batch;			// L^`
+		Vec2 center;				// L^Ƃ̒SW
+		int coolTime[3] = {};		// L^Ƃ̃N[^C
+		bool isValid = false;		// L^ς݂ǂ
+	};
+
+	/// <summary>
+	/// ACRƃN[^Cob`ɋL^
+	/// </summary>
+	/// <param name="record">L^</param>
+	/// <param name="center">`̒SW</param>
+	/// <param name="data">ȇIƃN[^C</param>
+	void RecordUi(Record& record, Vec2 center, const BulletData& data) const;
+
 	// ʏe摜nh
 	int _normalBulletHandle;
 
@@ -56,5 +81,8 @@ private:
 	// t[JE^
 	float _frame;
 
+	// ʂƂ̋L^(lςƂL^)
+	mutable std::vector<Record> _record;
+
 };
 
@@ -1,5 +1,5 @@
 #pragma once
-
+#include "SpriteBatch.h"
 
 class ResultUi
 {
@@ -44,5 +44,8 @@ private:
 
 	// {^摜nh
 	int _guide;
+
+	// ωȂUI܂Ƃ߂ċL^ob`
+	SpriteBatch _batch;
 };
 
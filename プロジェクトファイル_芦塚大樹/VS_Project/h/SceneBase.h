@@ -1,5 +1,6 @@
 #pragma once
 #include "Vec3.h"
+#include <memory>
 
 constexpr int SCENE_TITLE = 1;
 constexpr int SCENE_SELECT = 2;
@@ -9,7 +10,9 @@ constexpr int SCENE_RESELT = 5;
 
 class SceneManager;
 // V[̊NXASẴV[NX͂p
-class SceneBase
+// Đ̂ƂɃUgV[ogV[Ă悤Ashared_ptr悤ɂĂ
+class SceneBase :
+	public std::enable_shared_from_this<SceneBase>
 {
 public:
 	SceneBase();
@@ -21,6 +24,9 @@ public:
 	// `揈
 	virtual void Draw() const = 0;
 
+	// V[n߂Ƃ̏Ԃɖ߂(Đp)
+	virtual void Reset() {}
+
 protected:
 };
 
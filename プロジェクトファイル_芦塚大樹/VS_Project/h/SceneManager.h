@@ -25,6 +25,7 @@ public:
 
 	/// <summary>
 	/// ׂĂ̗vf`
+	/// ǉ̃V[Ƃ͉̃V[x`悵ĐÎ~ƂĎg܂킷
 	/// </summary>
 	void SceneDraw() const;
 
@@ -50,16 +51,31 @@ public:
 	/// <returns></returns>
 	bool GetGameEnd();
 
+	/// <summary>
+	/// I(Î~폜)
+	/// DxLib_EndOɌĂ
+	/// </summary>
+	void Terminate();
+
 
 private:
 	// vCx[gRXgN^
 	SceneManager() {};
 
+	// fXgN^(Î~Terminateō폜̂ŉȂ)
+	~SceneManager();
+
 	// eV[̃VFA|C^i[郊Xgz
 	std::list<std::shared_ptr<SceneBase>> _pScene;
 
 	// Q[ItO
 	bool _endFlag = false;
 
+	// ǉ̃V[̉ɕ\Î~̃nh
+	mutable int _backdropHandle = -1;
+
+	// Î~悪̉̃V[ʂĂ邩ǂ
+	mutable bool _isBackdropValid = false;
+
 };
 
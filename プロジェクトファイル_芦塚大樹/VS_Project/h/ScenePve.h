@@ -43,6 +43,12 @@ public:
 	/// </summary>
 	void Draw() const;
 
+	/// <summary>
+	/// Jn̏Ԃɖ߂(Đp)
+	/// Xe[WvC[̃fA`XN[͍蒼ɂ̂܂܎g
+	/// </summary>
+	void Reset();
+
 private:
 
 	// ֐|C^
@@ -5,6 +5,7 @@
 #include <memory>
 #include <vector>
 
+class DynamicResolution;
 class ItemManager;
 class PlayerBulletCollisionManager;
 class NumUtility;
@@ -43,6 +44,12 @@ public:
 	/// `揈
 	/// </summary>
 	void Draw() const;
+
+	/// <summary>
+	/// Jn̏Ԃɖ߂(Đp)
+	/// Xe[WvC[̃fA`XN[͍蒼ɂ̂܂܎g
+	/// </summary>
+	void Reset();
 private:
     // ֐|C^
     using m_updateFunc_t = void (ScenePvp::*)();
@@ -80,7 +87,10 @@ private:
     /// </summary>
     void FadeInDraw() const;
 
-    void MakeScreen();
+    /// <summary>
+    /// vC[Ƃ̕`XN[݂̉𑜓x̔{ō蒼
+    /// </summary>
+    void MakeScreen() const;
 
     // Xe[W|C^
     std::shared_ptr<StageManager> _pStage;
@@ -115,9 +125,12 @@ private:
     // NX|C^
     std::shared_ptr<NumUtility> _pNum;
 
+    // 𑜓x̔{߂NX
+    std::shared_ptr<DynamicResolution> _pResolution;
+
     // t[JE^
     int _frame;
 
-    std::vector<int> _screen;
+    mutable std::vector<int> _screen;
 };
 
@@ -14,8 +14,13 @@ class SceneResult :
 {
 public:
 
-
-	SceneResult(PlayerData data, int gameTime);
+	/// <summary>
+	/// RXgN^
+	/// </summary>
+	/// <param name="data">vC[f[^</param>
+	/// <param name="gameTime">ɂ</param>
+	/// <param name="battleScene">IogV[(Đ̂Ƃɂ̂܂܎g)</param>
+	SceneResult(PlayerData data, int gameTime, std::shared_ptr<SceneBase> battleScene = nullptr);
 
 	/// <summary>
 	/// fXgN^
@@ -82,5 +87,9 @@ private:
 
 	// Ƀ[hV[
 	int _nextScene;
+
+	// IogV[
+	// ĂԂ̓Xe[WvC[̃fȂ̂ŁAĐł͓ǂݍݒɍς
+	std::shared_ptr<SceneBase> _pBattleScene;
 };
 
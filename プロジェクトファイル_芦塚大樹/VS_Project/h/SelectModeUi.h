@@ -1,5 +1,6 @@
 #pragma once
 #include "Vec2.h"
+#include "SpriteBatch.h"
 
 constexpr int SOLO_MODE = 0;
 constexpr int MULTI_MODE = 1;
@@ -51,6 +52,11 @@ public:
 	int GetSelect() const;
 private:
 
+	/// <summary>
+	/// IɂĂςȂob`ɋL^
+	/// </summary>
+	void Record();
+
 	// t[JE^
 	int _frame;
 
@@ -109,5 +115,14 @@ private:
 
 	// ~̊g嗦
 	float _scale = 0.0f;
+
+	// ̉~艜ɕ`UĨob`
+	SpriteBatch _backBatch;
+
+	// ̉~Oɕ`UĨob`
+	SpriteBatch _frontBatch;
+
+	// ob`ɋL^_őIĂ{^
+	int _recordButtonNum = -1;
 };
 
@@ -1,9 +1,14 @@
 #pragma once
 #include "Components.h"
+#include "Constant.h"
+
+// Ăt闧̖̂ʂ̐
+constexpr int SKY_FACE_NUM = 6;
 
 class SkyDome :
 	public Transform,
-	public Model
+	public Model,
+	public Constant
 {
 public:
 
@@ -22,11 +27,24 @@ public:
 	/// </summary>
 	void Update();
 
+	/// <summary>
+	/// ]߂ɖ߂
+	/// (Ăt̓JƉ]ɂȂ̂ŏĂtȂ)
+	/// </summary>
+	void Reset();
+
 	/// <summary>
 	/// `揈
+	/// ĂtÃJ𒆐Sɂ̂ɓ\ĕ`悷
 	/// </summary>
 	void Draw() const;
 private:
 
-};
+	/// <summary>
+	/// h[𗧕̂6ʂɏĂt(JɂȂ̂ňxs)
+	/// </summary>
+	void Bake() const;
 
+	// ʂƂɏĂtXN[
+	mutable int _faceScreen[SKY_FACE_NUM];
+};
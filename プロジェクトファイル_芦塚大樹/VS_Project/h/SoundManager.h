@@ -1,6 +1,9 @@
 #pragma once
 #include "Singleton.h"
+#include "Constant.h"
+#include "Vec3.h"
 #include <map>
+#include <vector>
 
 constexpr int  VOLUME_MIN = 85;
 constexpr int  VOLUME_MIDDLE = 170;
@@ -30,10 +33,22 @@ constexpr int SE_DESTRUCTION = 15;
 constexpr int SE_GRAPPLE = 16;
 constexpr int SE_KO = 17;
 
+constexpr int MAX_SE_NUM = 18;
 
+// SE̕(ނƂɓɖ点鐔߂)
+constexpr int SE_CATEGORY_UI = 0;		// j[Ȃǂ̑쉹
+constexpr int SE_CATEGORY_SHOT = 1;		// e̔ˉ
+constexpr int SE_CATEGORY_IMPACT = 2;	// eEȂǂ̉
+constexpr int SE_CATEGORY_JINGLE = 3;	// JnEāEȂǂ̉ỏ
 
+constexpr int MAX_SE_CATEGORY_NUM = 4;
+
+// SERingSEŐςłAUpdateł܂Ƃ߂Ė炷
+// SEƂɕnhA󂢂Ă̂炷
+// ނƂ̏𒴂Dx̒Ⴂ̂~߁AĂvC[牓͖炳Ȃ
 class SoundManager:
-	public Singleton<SoundManager>
+	public Singleton<SoundManager>,
+	public Constant
 {
 public:
 
@@ -55,11 +70,32 @@ public:
 	void StopBGM(int bgm);
 
 	/// <summary>
-	/// SE炷
+	/// XV
+	/// ̃t[ɐς܂ꂽSEDx̍̂炷
+	/// ǂݍݒSE͓ǂݍ݂I܂ő҂A҂炳Ȃ
+	/// V[̍XV̌ɌĂ
+	/// </summary>
+	void Update();
+
+	/// <summary>
+	/// SE炷(ۂɖ炷̂Update)
 	/// </summary>
 	/// <param name="se">se萔</param>
 	void RingSE(int se);
 
+	/// <summary>
+	/// ʒuSE炷(ĂvC[牓Ζ炳Ȃ)
+	/// </summary>
+	/// <param name="se">se萔</param>
+	/// <param name="pos">W</param>
+	void RingSE(int se, const Vec3& pos);
+
+	/// <summary>
+	/// ̃t[̉𕷂ʒuǉ(Updateŏ)
+	/// </summary>
+	/// <param name="pos">ʒu(vC[̍WȂ)</param>
+	void AddListener(const Vec3& pos);
+
 	/// <summary>
 	/// BGM̉ʂݒ肷
 	/// </summary>
@@ -86,6 +122,39 @@ public:
 
 private:
 
+	// ς܂ꂽSE
+	struct SeCommand {
+		int se;
+		bool hasPos;
+		Vec3 pos;
+		int frame;		// ς܂ꂽt[
+	};
+
+	// ĂSE
+	struct Voice {
+		int handle;
+		int se;
+		int priority;
+		int startFrame;
+	};
+
+	/// <summary>
+	/// ǂݍ݂̏ISE𕡐āAɖ点鐔nhpӂ
+	/// </summary>
+	void CreateVoicePool();
+
+	/// <summary>
+	/// SE1炷
+	/// </summary>
+	/// <returns>点true</returns>
+	bool PlayVoice(const SeCommand& command);
+
+	/// <summary>
+	/// ĂSE~߂
+	/// </summary>
+	/// <param name="index">_playing̗vfԍ</param>
+	void StopVoice(int index);
+
 	// BGM
 	int _volumeBGM = VOLUME_MIDDLE;
 	
@@ -97,5 +166,26 @@ private:
 
 	// SE}bv
 	std::map<int, int> _seMap;
+
+	// SE̓ǂݍ݂n߂(NԂ̋L^p)
+	long long _seLoadTime = 0;
+
+	// SEƂ̕nh(ɂȂĂ͓̂ǂݍݒ)
+	std::vector<int> _voicePool[MAX_SE_NUM];
+
+	// ĂSE
+	std::vector<Voice> _playing;
+
+	// ̃t[ɐς܂ꂽSE
+	std::vector<SeCommand> _command;
+
+	// ǂݍ݂Î҂ĂSE
+	std::vector<SeCommand> _waiting;
+
+	// ̃t[̉𕷂ʒu
+	std::vector<Vec3> _listener;
+
+	// t[JE^(~߂SEIԂƂɌÂ̂)
+	int _frame = 0;
 };
 
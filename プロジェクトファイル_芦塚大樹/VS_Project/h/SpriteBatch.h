@@ -0,0 +1,110 @@
+#pragma once
+#include <vector>
+#include "DxLib.h"
+#include "Vec2.h"
+
+// 2D̃XvCgeNX`Ƃɂ܂Ƃ߂ĕ`悷NX
+// L^eClear܂ŕێ̂ŁAωȂ΋L^ɉxł`ł
+class SpriteBatch
+{
+public:
+
+	// eNX`̕`͈
+	struct Sprite {
+		int page = -1;			// eNX`̃OtBbNnh
+		float u0 = 0.0f;		// UW
+		float v0 = 0.0f;		// VW
+		float u1 = 1.0f;		// EUW
+		float v1 = 1.0f;		// EVW
+		int width = 0;			// 摜̕
+		int height = 0;			// 摜̍
+	};
+
+	/// <summary>
+	/// RXgN^
+	/// </summary>
+	SpriteBatch();
+
+	/// <summary>
+	/// fXgN^
+	/// </summary>
+	virtual ~SpriteBatch();
+
+	/// <summary>
+	/// OtBbNnhXvCg
+	/// </summary>
+	/// <param name="handle">OtBbNnh</param>
+	/// <returns>摜Ŝ͈͂ƂXvCg</returns>
+	static Sprite MakeSprite(int handle);
+
+	/// <summary>
+	/// L^eׂď
+	/// </summary>
+	void Clear();
+
+	/// <summary>
+	/// XvCg𒆐SWwŋL^(DrawRotaGraph)
+	/// </summary>
+	/// <param name="sprite">XvCg</param>
+	/// <param name="center">SW</param>
+	/// <param name="exRate">g嗦</param>
+	/// <param name="angle">]px</param>
+	/// <param name="layer">`揇(قǐɕ`悷)</param>
+	/// <param name="blendMode">uh[h</param>
+	/// <param name="blendParam">uh̃p[^</param>
+	void AddSprite(const Sprite& sprite, Vec2 center, double exRate = 1.0, double angle = 0.0, int layer = 0, int blendMode = DX_BLENDMODE_ALPHA, int blendParam = 255);
+
+	/// <summary>
+	/// OtBbNnh𒆐SWwŋL^(DrawRotaGraph)
+	/// </summary>
+	void AddRotaGraph(int x, int y, double exRate, double angle, int handle, int layer = 0, int blendMode = DX_BLENDMODE_ALPHA, int blendParam = 255);
+
+	/// <summary>
+	/// OtBbNnhWwŋL^(DrawGraph)
+	/// </summary>
+	void AddGraph(int x, int y, int handle, int layer = 0, int blendMode = DX_BLENDMODE_ALPHA, int blendParam = 255);
+
+	/// <summary>
+	/// hԂlp`L^(DrawBox)
+	/// </summary>
+	void AddBox(int x1, int y1, int x2, int y2, unsigned int color, int layer = 0, int blendMode = DX_BLENDMODE_ALPHA, int blendParam = 255);
+
+	/// <summary>
+	/// L^e`悷
+	/// C[őċL^AeNX`ƃuh[ĥ̕`ɂ܂Ƃ߂
+	/// (C[͋L^ɕ`悷)
+	/// </summary>
+	void Draw() const;
+
+	/// <summary>
+	/// L^ĂȂǂ
+	/// </summary>
+	/// <returns>Ȃtrue</returns>
+	bool IsEmpty() const;
+
+private:
+
+	// ̕`ł܂Ƃ߂ĕ`P
+	struct Batch {
+		int layer;
+		int blendMode;
+		int blendParam;
+		int page;
+		std::vector<VERTEX2D> vertex;
+	};
+
+	/// <summary>
+	/// C[̍Ō̂܂Ƃ܂肪ɍ΂ԂAȂ΃C[̖ɍ
+	/// </summary>
+	/// <returns>_ǉ܂Ƃ܂</returns>
+	Batch& FindBatch(int layer, int blendMode, int blendParam, int page);
+
+	/// <summary>
+	/// lp`2̎Op`ƂĒǉ
+	/// </summary>
+	void PushQuad(Batch& batch, const VECTOR pos[4], const Sprite& sprite, COLOR_U8 color);
+
+	// L^܂Ƃ܂(C[ɕׂĂ)
+	std::vector<Batch> _batch;
+};
+
@@ -0,0 +1,63 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+// 1̃Xbhς݁Aʂ1̃XbhoAbNgȂŒ蒷̃L[
+// ςޑPushAoPeekPopĂ
+// eʂ2ׂ̂ɂ
+template<typename T, size_t N>
+class SpscQueue
+{
+	static_assert(N > 0 && (N & (N - 1)) == 0, "SpscQueue: N must be a power of two");
+
+public:
+
+	/// <summary>
+	/// ɐς(ςޑ̃XbhŌĂ)
+	/// </summary>
+	/// <param name="value">ςޒl</param>
+	/// <returns>ςŐς߂Ȃfalse</returns>
+	bool Push(const T& value) {
+		size_t tail = _tail.load(std::memory_order_relaxed);
+		if (tail - _head.load(std::memory_order_acquire) == N) return false;
+
+		_buffer[tail & (N - 1)] = value;
+
+		// lĂ疖i߁AoɌ悤ɂ
+		_tail.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	/// <summary>
+	/// 擪oɌ(õXbhŌĂ)
+	/// </summary>
+	/// <param name="value">擪̒l󂯎ϐ</param>
+	/// <returns>Ȃfalse</returns>
+	bool Peek(T& value) const {
+		size_t head = _head.load(std::memory_order_relaxed);
+		if (head == _tail.load(std::memory_order_acquire)) return false;
+
+		value = _buffer[head & (N - 1)];
+		return true;
+	}
+
+	/// <summary>
+	/// 擪̂Ă(PeekŒlƂAõXbhŌĂ)
+	/// </summary>
+	void Pop() {
+		_head.store(_head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+	}
+
+private:
+
+	// luꏊ
+	std::array<T, N> _buffer = {};
+
+	// Ɏoʒu(oi߂)
+	// ςޑƎoœLbVC荇Ȃ悤Ă
+	alignas(64) std::atomic<size_t> _head = 0;
+
+	// ɐςވʒu(ςޑi߂)
+	alignas(64) std::atomic<size_t> _tail = 0;
+};
@@ -35,13 +35,13 @@ public:
     /// <param name="z">}X̗vfz</param>
     void DeleteBox(int x, int y, int z);
 
-private:
-
-    // fnh
-    int _modelHandleGreen;
-    int _modelHandleRed;
-
+    /// <summary>
+    /// {bNXׂČɖ߂(Đp)
+    /// f͂̂܂܎g
+    /// </summary>
+    void ResetStage();
 
+private:
 
     int _stage[BLOCK_NUM_X][BLOCK_NUM_Y][BLOCK_NUM_Z];
 
@@ -0,0 +1,89 @@
+#pragma once
+#include <functional>
+#include <future>
+#include <string>
+#include <vector>
+
+// N̏Aˑ֌W(m[h)̏W܂ƂĎsNX
+// ˑ悪ׂďIm[hsAˑ֌ŴȂm[hm͓ɐi߂
+// DxLibEEffekseer̊֐Ăԃm[h̓CXbhŁAt@C̉͂sm[h
+// AssetLoader̓ǂݍݗp̃XbhŎs
+class StartupGraph
+{
+public:
+
+	// m[hsXbh
+	enum class Thread {
+		Main,		// CXbh(DxLibEEffekseerg)
+		Worker,		// ǂݍݗp̃Xbh(DxLibgȂ)
+	};
+
+	/// <summary>
+	/// RXgN^
+	/// </summary>
+	StartupGraph();
+
+	/// <summary>
+	/// fXgN^
+	/// </summary>
+	virtual ~StartupGraph();
+
+	/// <summary>
+	/// m[hǉ
+	/// CXbh̃m[h́AɎsł̂ΐɒǉ̂s
+	/// </summary>
+	/// <param name="name">m[h̖O(NԂ̋L^ɂg)</param>
+	/// <param name="thread">sXbh</param>
+	/// <param name="depend">ɏIĂKvm[h̖O</param>
+	/// <param name="func">(sfalseԂ)</param>
+	void Add(const std::string& name, Thread thread, const std::vector<std::string>& depend, std::function<bool()> func);
+
+	/// <summary>
+	/// ׂẴm[hs
+	/// sm[hɈˑĂm[h͎sȂ
+	/// </summary>
+	/// <returns>ׂẴm[htrue</returns>
+	bool Run();
+
+private:
+
+	// m[h̏
+	enum class State {
+		Wait,		// ˑ̏I҂
+		Running,	// ǂݍݗp̃XbhŎs
+		Done,		// 
+		Failed,		// s(ˑ̎s܂)
+	};
+
+	// m[h
+	struct Node {
+		std::string name;
+		Thread thread;
+		std::vector<std::string> dependName;
+		std::vector<int> depend;		// ˑ̃m[h̔ԍ
+		std::function<bool()> func;
+		State state = State::Wait;
+		std::future<void> future;		// ǂݍݗp̃Xbhł̎s̊
+		bool result = false;			// ǂݍݗp̃Xbhł̎s
+	};
+
+	/// <summary>
+	/// ˑ̖Om[h̔ԍɒ
+	/// </summary>
+	void ResolveDepend();
+
+	/// <summary>
+	/// ˑ̏Ԃm[hsł邩ׂ
+	/// ˑ悪sĂ΃m[hsɂ
+	/// </summary>
+	/// <returns>słtrue</returns>
+	bool IsReady(Node& node);
+
+	/// <summary>
+	/// m[h̏NԂ̋L^tĎs
+	/// </summary>
+	static bool Execute(const Node& node);
+
+	// ǉꂽm[h
+	std::vector<Node> _node;
+};
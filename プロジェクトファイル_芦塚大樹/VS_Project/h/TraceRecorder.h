@@ -0,0 +1,140 @@
+#pragma once
+#include "Singleton.h"
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Nŏɑłt[܂ł̏ԂL^VOgNX
+// L^ԂChromẽg[X`(chrome://tracing PerfettoŊJJSON)ŏo
+// ǂݍݗp̃XbhL^ł
+// o͋L^߂̂ŁAQ[ɋԂu܂܂ɂĂׂɂȂȂ
+// Q[̃t[𒲂ׂƂ́AStartŋL^蒼
+class TraceRecorder :
+	public Singleton<TraceRecorder>
+{
+	friend class Singleton<TraceRecorder>;
+
+public:
+
+	/// <summary>
+	/// L^n߂̌oߎԂ擾
+	/// </summary>
+	/// <returns>oߎ(}CNb)</returns>
+	long long GetTime() const;
+
+	/// <summary>
+	/// Ă񂾃Xbhōs̋ԂL^
+	/// </summary>
+	/// <param name="name">Ԃ̖O</param>
+	/// <param name="category">(initEloadEsceneȂ)</param>
+	/// <param name="detail">t@CpXȂǂ̕⑫(Ȃ΋)</param>
+	/// <param name="begin">Jn(GetTime̒l)</param>
+	/// <param name="end">I(GetTime̒l)</param>
+	void AddSpan(const std::string& name, const char* category, const std::string& detail, long long begin, long long end);
+
+	/// <summary>
+	/// 񓯊ǂݍ݂̂悤ɁAXbh܂ōsꂽ̋ԂL^
+	/// (dȂĂ悢悤Aʂ̗ɕ\)
+	/// </summary>
+	/// <param name="name">Ԃ̖O</param>
+	/// <param name="category"></param>
+	/// <param name="detail">t@CpXȂǂ̕⑫(Ȃ΋)</param>
+	/// <param name="begin">Jn(GetTime̒l)</param>
+	/// <param name="end">I(GetTime̒l)</param>
+	void AddAsyncSpan(const std::string& name, const char* category, const std::string& detail, long long begin, long long end);
+
+	/// <summary>
+	/// L^ǂ
+	/// </summary>
+	/// <returns>L^Ȃtrue</returns>
+	bool IsRecording() const;
+
+	/// <summary>
+	/// L^ɂāAL^蒼
+	/// </summary>
+	void Start();
+
+	/// <summary>
+	/// L^t@CɏoAȍ~̋L^߂
+	/// </summary>
+	/// <param name="path">ot@C̃pX(Ȃ珑oɋL^̂Ă)</param>
+	void Finish(const std::string& path);
+
+private:
+
+	// vCx[gRXgN^
+	TraceRecorder();
+
+	// L^
+	struct Span {
+		std::string name;
+		const char* category;
+		std::string detail;
+		long long begin;
+		long long end;
+		int thread;			// L^Xbh̔ԍ(񓯊̋Ԃ-1)
+		int asyncId;		// 񓯊̋Ԃ̔ԍ
+	};
+
+	/// <summary>
+	/// Ă񂾃Xbh̔ԍ擾(߂ẴXbhɂ͔ԍU)
+	/// _mutexbNԂŌĂ
+	/// </summary>
+	int GetThreadNumber();
+
+	/// <summary>
+	/// JSON̕ɓ悤ɃGXP[v
+	/// </summary>
+	static std::string Escape(const std::string& text);
+
+	// L^n߂
+	std::chrono::steady_clock::time_point _start;
+
+	// L^
+	std::vector<Span> _span;
+
+	// ԍUXbh
+	std::vector<std::thread::id> _thread;
+
+	// 񓯊̋ԂɐUԍ̐
+	int _asyncCount;
+
+	// L^ǂ
+	std::atomic<bool> _isRecording;
+
+	// Ԃ̒ǉ
+	std::mutex _mutex;
+};
+
+// XR[vɓĂo܂łԂƂTraceRecorderɋL^NX
+class TraceScope
+{
+public:
+
+	/// <summary>
+	/// RXgN^(Ԃ̊Jn)
+	/// </summary>
+	/// <param name="name">Ԃ̖O</param>
+	/// <param name="category"></param>
+	/// <param name="detail">t@CpXȂǂ̕⑫</param>
+	TraceScope(const char* name, const char* category, const std::string& detail = "");
+
+	/// <summary>
+	/// fXgN^(Ԃ̏I)
+	/// </summary>
+	~TraceScope();
+
+	// Rs[֎~
+	TraceScope(const TraceScope&) = delete;
+	void operator=(const TraceScope&) = delete;
+
+private:
+
+	const char* _name;
+	const char* _category;
+	std::string _detail;
+	long long _begin;
+};
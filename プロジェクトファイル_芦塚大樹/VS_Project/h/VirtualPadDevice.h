@@ -0,0 +1,102 @@
+#pragma once
+#include "InputDevice.h"
+#include <string>
+#include <vector>
+
+// Rg[[Ȃœz̃pbh̓͑u
+// Setœ͂𒼐ڗ^邩AXNvgCSVǂݍŃeBbNƂɍĐ
+// XNvg̍śueBbN,{^,XeBbNX,XeBbNY,EXeBbNX,EXeBbNYvŁA
+// {^́uA|RTv̂悤ɖO|łȂBs͎̓͂̍s̃eBbN܂őAŌ̍s̃eBbNōŏɖ߂
+class VirtualPadDevice :
+	public InputDevice
+{
+public:
+
+	/// <summary>
+	/// RXgN^
+	/// </summary>
+	VirtualPadDevice();
+
+	/// <summary>
+	/// fXgN^
+	/// </summary>
+	virtual ~VirtualPadDevice();
+
+	/// <summary>
+	/// XNvgǂݍ
+	/// </summary>
+	/// <param name="path">XNvgCSṼpX</param>
+	/// <param name="startTick">ŏɍĐeBbN(pbhƂɂ炵ēɂȂȂ悤ɂ)</param>
+	/// <returns>ǂݍ߂Ȃfalse</returns>
+	bool LoadScript(const std::string& path, int startTick);
+
+	/// <summary>
+	/// ̃eBbN̓͂𒼐ڗ^(XNvgǂݍłȂƂɎg)
+	/// </summary>
+	/// <param name="sample">(͎gȂ)</param>
+	void Set(const PadSample& sample);
+
+	/// <summary>
+	/// XV(XNvg1eBbNi߂)
+	/// </summary>
+	/// <param name="tickTime">̃eBbN̏I̎</param>
+	virtual void Update(long long tickTime);
+
+	/// <summary>
+	/// ̃eBbN̓͂oɌ
+	/// </summary>
+	/// <param name="tickTime">̃eBbN̏I̎</param>
+	/// <param name="sample">͂󂯎ϐ</param>
+	/// <returns>oς݂Ȃfalse</returns>
+	virtual bool Peek(long long tickTime, PadSample& sample);
+
+	/// <summary>
+	/// PeekŌ͂̂Ă
+	/// </summary>
+	virtual void Pop();
+
+	/// <summary>
+	/// ȂĂ邩ǂ(z̃pbh͏ɂȂĂƂ݂Ȃ)
+	/// </summary>
+	/// <returns>true</returns>
+	virtual bool IsConnected() const;
+
+	/// <summary>
+	/// XNvgǂݍ񂾂Ƃ̃eBbNĐ
+	/// </summary>
+	/// <returns>XNvgǂݍłtrue</returns>
+	virtual bool Restart();
+
+private:
+
+	/// <summary>
+	/// uA|RTv̂悤ȃ{^̖O̕тrbgɒ
+	/// </summary>
+	/// <param name="text">{^̖O̕</param>
+	/// <returns>{^̃rbg</returns>
+	static unsigned int ParseButtons(const std::string& text);
+
+	// XNvg1s
+	struct ScriptRow {
+		int tick;			// ͂n߂eBbN
+		PadSample sample;	// 
+	};
+
+	// ǂݍ񂾃XNvg
+	std::vector<ScriptRow> _script;
+
+	// ĐĂeBbN
+	int _tick;
+
+	// ŏɍĐeBbN
+	int _startTick;
+
+	// ĐĂs
+	int _row;
+
+	// ̃eBbN̓
+	PadSample _sample;
+
+	// ͂܂oĂȂǂ
+	bool _hasSample;
+};
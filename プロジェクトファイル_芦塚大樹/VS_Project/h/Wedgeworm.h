@@ -13,8 +13,7 @@ public:
 	/// RXgN^
 	/// </summary>
 	/// <param name="num">io[</param>
-	/// 
-	
+	/// <param name="model">ς݂̃fnh(̃NX폜)</param>
 	Wedgeworm(int num,int model);
 
 	/// <summary>
@@ -27,6 +26,12 @@ public:
 	/// </summary>
 	void Update();
 
+	/// <summary>
+	/// ʒuɖ߂
+	/// </summary>
+	/// <param name="num">io[</param>
+	void Reset(int num);
+
 	/// <summary>
 	/// `揈
 	/// </summary>
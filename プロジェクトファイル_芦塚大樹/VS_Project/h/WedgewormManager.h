@@ -34,6 +34,11 @@ public:
 	/// <returns>W</returns>
 	Vec3 GetPos(int num) const;
 
+	/// <summary>
+	/// Sʒuɖ߂(Đp)
+	/// </summary>
+	void Reset();
+
 private:
 
 	// wormIuWFNg̔z
@@ -1,9 +1,13 @@
 #include "DxLib.h"
 #include "Application.h"
+#include "TraceRecorder.h"
 
 //int WINAPI WinMain(HINSTANCE, HINSTANCE, LPSTR, int) 
 int main()
 {
+	// NԂ̋L^n߂
+	TraceRecorder::GetInstance();
+
 	auto& application = Application::GetInstance();
 	if (!application.Init()) return-1;
 
@@ -0,0 +1,308 @@
+#pragma once
+#include <cmath>
+
+// EBhEȂŃQ[̍XVs߂́ADxLib̑̃wb_[
+// Q[gĂ֐𓯂`Ő錾ADxLibNull.cppŒĝȂɂ
+// (`ETEhEpbh͉AxNgƍšvZEE͖{ƓʂԂ)
+// WindowsȊOłDxLibgȂ̂ŁACMakeLists.txtł̃tH_ɒT
+
+#ifndef TRUE
+#define TRUE 1
+#endif
+#ifndef FALSE
+#define FALSE 0
+#endif
+
+typedef char TCHAR;
+typedef long long LONGLONG;
+
+// ~
+#define DX_PI			(3.1415926535897932384626433832795)
+#define DX_PI_F			(3.1415926535897932384626433832795f)
+#define DX_TWO_PI		(3.1415926535897932384626433832795 * 2.0)
+#define DX_TWO_PI_F		(3.1415926535897932384626433832795f * 2.0f)
+
+// `̐ݒ
+#define DX_DIRECT3D_11			(3)
+#define DX_DRAWMODE_NEAREST		(0)
+#define DX_DRAWMODE_BILINEAR	(1)
+#define DX_TEXADDRESS_WRAP		(1)
+#define DX_TEXADDRESS_CLAMP		(3)
+#define DX_BLENDMODE_NOBLEND	(0)
+#define DX_BLENDMODE_ALPHA		(1)
+#define DX_BLENDMODE_MULA		(11)
+#define DX_SCREEN_BACK			(0xfffffffe)
+#define DX_NONE_GRAPH			(0xfffffffb)
+
+// TEh̐ݒ
+#define DX_PLAYTYPE_BACK			(1)
+#define DX_PLAYTYPE_LOOP			(3)
+#define DX_SOUNDDATATYPE_MEMNOPRESS	(0)
+#define DX_SOUNDDATATYPE_FILE		(3)
+
+// pbh
+#define DX_INPUT_PAD1					(0x0001)
+#define XINPUT_BUTTON_DPAD_UP			(0)
+#define XINPUT_BUTTON_DPAD_DOWN			(1)
+#define XINPUT_BUTTON_DPAD_LEFT			(2)
+#define XINPUT_BUTTON_DPAD_RIGHT		(3)
+#define XINPUT_BUTTON_START				(4)
+#define XINPUT_BUTTON_BACK				(5)
+#define XINPUT_BUTTON_LEFT_THUMB		(6)
+#define XINPUT_BUTTON_RIGHT_THUMB		(7)
+#define XINPUT_BUTTON_LEFT_SHOULDER		(8)
+#define XINPUT_BUTTON_RIGHT_SHOULDER	(9)
+#define XINPUT_BUTTON_A					(12)
+#define XINPUT_BUTTON_B					(13)
+#define XINPUT_BUTTON_X					(14)
+#define XINPUT_BUTTON_Y					(15)
+
+// }EX
+#define MOUSE_INPUT_LEFT	(0x0001)
+#define MOUSE_INPUT_RIGHT	(0x0002)
+#define MOUSE_INPUT_MIDDLE	(0x0004)
+
+// L[{[h
+#define KEY_INPUT_BACK		(0x0E)
+#define KEY_INPUT_RETURN	(0x1C)
+#define KEY_INPUT_LSHIFT	(0x2A)
+#define KEY_INPUT_ESCAPE	(0x01)
+#define KEY_INPUT_SPACE		(0x39)
+#define KEY_INPUT_LEFT		(0xCB)
+#define KEY_INPUT_UP		(0xC8)
+#define KEY_INPUT_RIGHT		(0xCD)
+#define KEY_INPUT_DOWN		(0xD0)
+#define KEY_INPUT_A			(0x1E)
+#define KEY_INPUT_D			(0x20)
+#define KEY_INPUT_E			(0x12)
+#define KEY_INPUT_F			(0x21)
+#define KEY_INPUT_Q			(0x10)
+#define KEY_INPUT_S			(0x1F)
+#define KEY_INPUT_W			(0x11)
+#define KEY_INPUT_Z			(0x2C)
+
+namespace DxLib
+{
+	// s
+	struct MATRIX
+	{
+		float m[4][4];
+	};
+
+	// xNg
+	struct VECTOR
+	{
+		float x, y, z;
+	};
+
+	// float^̃J[l
+	struct COLOR_F
+	{
+		float r, g, b, a;
+	};
+
+	// unsigned char^̃J[l
+	struct COLOR_U8
+	{
+		unsigned char b, g, r, a;
+	};
+
+	// 2D`̒_
+	struct VERTEX2D
+	{
+		VECTOR pos;
+		float rhw;
+		COLOR_U8 dif;
+		float u, v;
+	};
+
+	// 3D`̒_
+	struct VERTEX3D
+	{
+		VECTOR pos;
+		VECTOR norm;
+		COLOR_U8 dif;
+		COLOR_U8 spc;
+		float u, v;
+		float su, sv;
+	};
+
+	// XInput̃pbh̓
+	struct XINPUT_STATE
+	{
+		unsigned char Buttons[16];
+		unsigned char LeftTrigger;
+		unsigned char RightTrigger;
+		short ThumbLX;
+		short ThumbLY;
+		short ThumbRX;
+		short ThumbRY;
+	};
+
+	// ͈
+	struct RECT
+	{
+		long left, top, right, bottom;
+	};
+
+	// xNǧvZ(DxLib̃CC֐Ɠ)
+	inline VECTOR VGet(float x, float y, float z) { return VECTOR{ x, y, z }; }
+	inline VECTOR VAdd(const VECTOR& In1, const VECTOR& In2) { return VECTOR{ In1.x + In2.x, In1.y + In2.y, In1.z + In2.z }; }
+	inline VECTOR VSub(const VECTOR& In1, const VECTOR& In2) { return VECTOR{ In1.x - In2.x, In1.y - In2.y, In1.z - In2.z }; }
+	inline VECTOR VScale(const VECTOR& In, float Scale) { return VECTOR{ In.x * Scale, In.y * Scale, In.z * Scale }; }
+	inline float VDot(const VECTOR& In1, const VECTOR& In2) { return In1.x * In2.x + In1.y * In2.y + In1.z * In2.z; }
+	inline VECTOR VCross(const VECTOR& In1, const VECTOR& In2) { return VECTOR{ In1.y * In2.z - In1.z * In2.y, In1.z * In2.x - In1.x * In2.z, In1.x * In2.y - In1.y * In2.x }; }
+	inline float VSize(const VECTOR& In) { return std::sqrt(VDot(In, In)); }
+	inline VECTOR VTransform(const VECTOR& InV, const MATRIX& InM)
+	{
+		VECTOR Result;
+		Result.x = InV.x * InM.m[0][0] + InV.y * InM.m[1][0] + InV.z * InM.m[2][0] + InM.m[3][0];
+		Result.y = InV.x * InM.m[0][1] + InV.y * InM.m[1][1] + InV.z * InM.m[2][1] + InM.m[3][1];
+		Result.z = InV.x * InM.m[0][2] + InV.y * InM.m[1][2] + InV.z * InM.m[2][2] + InM.m[3][2];
+		return Result;
+	}
+
+	// s
+	MATRIX MGetIdent();
+	MATRIX MGetRotX(float XAxisRotate);
+	MATRIX MGetRotY(float YAxisRotate);
+	MATRIX MGetScale(VECTOR Scale);
+	MATRIX MGetTranslate(VECTOR Trans);
+	MATRIX MMult(MATRIX In1, MATRIX In2);
+
+	// EI
+	int DxLib_Init();
+	int DxLib_End();
+	int ProcessMessage();
+	int ChangeWindowMode(int Flag);
+	int SetWindowTextDX(const TCHAR* WindowText);
+	int SetWindowSize(int Width, int Height);
+	int SetGraphMode(int ScreenSizeX, int ScreenSizeY, int ColorBitDepth, int RefreshRate = 60);
+	int SetUseDirect3DVersion(int Version);
+	int SetAlwaysRunFlag(int Flag);
+	int SetWaitVSyncFlag(int Flag);
+	int SetChangeScreenModeGraphicsSystemResetFlag(int Flag);
+	int SetMouseDispFlag(int DispFlag);
+	int GetWindowActiveFlag();
+	const void* GetUseDirect3D11DeviceContext();
+
+	// EEO
+	LONGLONG GetNowHiPerformanceCount(int UseRDTSCFlag = FALSE);
+	int GetRand(int RandMax);
+	int LogFileFmtAdd(const TCHAR* FormatString, ...);
+
+	// t@C
+	LONGLONG FileRead_size(const TCHAR* FilePath);
+
+	// 񓯊ǂݍ
+	int SetUseASyncLoadFlag(int Flag);
+	int SetASyncLoadThreadNum(int ThreadNum);
+	int CheckHandleASyncLoad(int Handle);
+
+	// `
+	int SetDrawScreen(int DrawScreen);
+	int GetDrawScreen();
+	int ClearDrawScreen(const RECT* ClearRect = nullptr);
+	int ScreenFlip();
+	int RenderVertex();
+	int SetBackgroundColor(int Red, int Green, int Blue, int Alpha = 0);
+	int SetDrawArea(int x1, int y1, int x2, int y2);
+	int SetDrawMode(int DrawMode);
+	int GetDrawMode();
+	int SetTextureAddressMode(int Mode, int Stage = -1);
+	int GetDrawArea(RECT* Rect);
+	int SetDrawBlendMode(int BlendMode, int BlendParam);
+	int SetUseZBuffer3D(int Flag);
+	int SetWriteZBuffer3D(int Flag);
+	int SetUseBackCulling(int Flag);
+	int GetDrawScreenSize(int* XBuf, int* YBuf);
+	int GetDrawScreenGraph(int x1, int y1, int x2, int y2, int GrHandle, int UseClientFlag = TRUE);
+	COLOR_F GetColorF(float Red, float Green, float Blue, float Alpha);
+	COLOR_U8 GetColorU8(int Red, int Green, int Blue, int Alpha);
+
+	// 摜
+	int LoadGraph(const TCHAR* FileName, int NotUse3DFlag = FALSE);
+	int MakeGraph(int SizeX, int SizeY, int NotUse3DFlag = FALSE);
+	int MakeScreen(int SizeX, int SizeY, int UseAlphaChannel = FALSE);
+	int DerivationGraph(int SrcX, int SrcY, int Width, int Height, int SrcGraphHandle);
+	int DeleteGraph(int GrHandle, int LogOutFlag = FALSE);
+	int GetGraphSize(int GrHandle, int* SizeXBuf, int* SizeYBuf);
+	int GetGraphTextureSize(int GrHandle, int* SizeXBuf, int* SizeYBuf);
+	int DrawGraph(int x, int y, int GrHandle, int TransFlag);
+	int DrawExtendGraph(int x1, int y1, int x2, int y2, int GrHandle, int TransFlag);
+	int DrawRotaGraph(int x, int y, double ExRate, double Angle, int GrHandle, int TransFlag, int ReverseXFlag = FALSE, int ReverseYFlag = FALSE);
+	int DrawPolygon2D(const VERTEX2D* VertexArray, int PolygonNum, int GrHandle, int TransFlag);
+	int DrawBox(int x1, int y1, int x2, int y2, unsigned int Color, int FillFlag);
+	int DrawString(int x, int y, const TCHAR* String, unsigned int Color, unsigned int EdgeColor = 0);
+	int DrawFormatString(int x, int y, unsigned int Color, const TCHAR* FormatString, ...);
+
+	// 3D`
+	int DrawLine3D(VECTOR Pos1, VECTOR Pos2, unsigned int Color);
+	int DrawSphere3D(VECTOR CenterPos, float r, int DivNum, unsigned int DifColor, unsigned int SpcColor, int FillFlag);
+	int DrawPolygon3D(const VERTEX3D* VertexArray, int PolygonNum, int GrHandle, int TransFlag);
+	int DrawCapsule3D(VECTOR Pos1, VECTOR Pos2, float r, int DivNum, unsigned int DifColor, unsigned int SpcColor, int FillFlag);
+
+	// J
+	int SetCameraNearFar(float Near, float Far);
+	int SetCameraPositionAndTarget_UpVecY(VECTOR Position, VECTOR Target);
+	int SetCameraPositionAndTargetAndUpVec(VECTOR Position, VECTOR TargetPosition, VECTOR UpVector);
+	int SetCameraScreenCenter(float x, float y);
+	int SetupCamera_Perspective(float Fov);
+	int GetCameraScreenCenter(float* x, float* y);
+	float GetCameraNear();
+	float GetCameraFar();
+	int SetCameraViewMatrix(MATRIX ViewMatrix);
+	int SetupCamera_ProjectionMatrix(MATRIX ProjectionMatrix);
+	VECTOR GetCameraPosition();
+	VECTOR GetCameraFrontVector();
+	MATRIX GetCameraViewMatrix();
+	MATRIX GetCameraProjectionMatrix();
+
+	// Cg
+	int SetUseLighting(int Flag);
+	int SetLightDifColor(COLOR_F Color);
+	int SetLightDirection(VECTOR Direction);
+	int CreateDirLightHandle(VECTOR Direction);
+	int SetLightDifColorHandle(int LHandle, COLOR_F Color);
+	int SetLightDirectionHandle(int LHandle, VECTOR Direction);
+	int DeleteLightHandle(int LHandle);
+	int DeleteLightHandleAll();
+
+	// f
+	int MV1LoadModel(const TCHAR* FileName);
+	int MV1DuplicateModel(int SrcMHandle);
+	int MV1DeleteModel(int MHandle);
+	int MV1DrawModel(int MHandle);
+	int MV1SetPosition(int MHandle, VECTOR Position);
+	int MV1SetScale(int MHandle, VECTOR Scale);
+	int MV1SetMatrix(int MHandle, MATRIX Matrix);
+	VECTOR MV1GetFramePosition(int MHandle, int FrameIndex);
+	int MV1GetTextureNum(int MHandle);
+	int MV1GetTextureGraphHandle(int MHandle, int TexIndex);
+	int MV1SetTextureGraphHandle(int MHandle, int TexIndex, int GrHandle, int SemiTransFlag);
+	int MV1AttachAnim(int MHandle, int AnimIndex, int AnimSrcMHandle = -1, int NameCheck = TRUE);
+	int MV1DetachAnim(int MHandle, int AttachIndex);
+	float MV1GetAttachAnimTotalTime(int MHandle, int AttachIndex);
+	int MV1SetAttachAnimTime(int MHandle, int AttachIndex, float Time);
+	int MV1SetAttachAnimBlendRate(int MHandle, int AttachIndex, float Rate = 1.0f);
+
+	// TEh
+	int SetCreateSoundDataType(int SoundDataType);
+	int LoadSoundMem(const TCHAR* FileName, int BufferNum = 3, int UnionHandle = -1);
+	int LoadBGM(const TCHAR* FileName);
+	int DuplicateSoundMem(int SrcSoundHandle, int BufferNum = 3);
+	int PlaySoundMem(int SoundHandle, int PlayType, int TopPositionFlag = TRUE);
+	int StopSoundMem(int SoundHandle, int IsNextLoopEnd = FALSE);
+	int CheckSoundMem(int SoundHandle);
+	int ChangeVolumeSoundMem(int VolumePal, int SoundHandle);
+
+	// 
+	int GetJoypadNum();
+	int GetJoypadXInputState(int InputType, XINPUT_STATE* XInputState);
+	int CheckHitKey(int KeyCode);
+	int GetMouseInput();
+	int GetMousePoint(int* XBuf, int* YBuf);
+	int SetMousePoint(int PointX, int PointY);
+}
+
+using namespace DxLib;
@@ -0,0 +1,395 @@
+#include "DxLib.h"
+#include <atomic>
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <filesystem>
+#include <mutex>
+#include <random>
+#include <unordered_map>
+
+namespace {
+	// f̃Aj[V̑Đ
+	// (Aj[V̏I҂iނ悤A0ł͂Ȃۂ̃[Vɋ߂ɂ)
+	constexpr float NULL_ANIM_TOTAL_TIME = 30.0f;
+
+	// ̎(x点ĂɂȂ悤ɌŒ肷)
+	constexpr unsigned int NULL_RAND_SEED = 0;
+
+	// 摜EfETEhȂǂɐUnh
+	// (ǂݍ݂ɎsɂȂȂ悤A1珇ɐU)
+	std::atomic<int> g_handleCount = 0;
+
+	int NewHandle()
+	{
+		return ++g_handleCount;
+	}
+
+	// fƂ́AŌɒuʒu(MV1GetFramePositionŕԂ)
+	std::unordered_map<int, VECTOR> g_modelPosition;
+	std::mutex g_modelMutex;
+
+	// GetRand̗
+	std::mt19937 g_random(NULL_RAND_SEED);
+
+	// `
+	int g_drawScreen = static_cast<int>(DX_SCREEN_BACK);
+
+	// J
+	VECTOR g_cameraPosition = {};
+	VECTOR g_cameraTarget = { 0.0f, 0.0f, 1.0f };
+	float g_cameraNear = 10.0f;
+	float g_cameraFar = 10000.0f;
+}
+
+namespace DxLib
+{
+	// s
+
+	MATRIX MGetIdent()
+	{
+		MATRIX result = {};
+		for (int i = 0; i < 4; i++) {
+			result.m[i][i] = 1.0f;
+		}
+		return result;
+	}
+
+	MATRIX MGetRotX(float XAxisRotate)
+	{
+		MATRIX result = MGetIdent();
+		float sin = std::sin(XAxisRotate);
+		float cos = std::cos(XAxisRotate);
+		result.m[1][1] = cos;
+		result.m[1][2] = sin;
+		result.m[2][1] = -sin;
+		result.m[2][2] = cos;
+		return result;
+	}
+
+	MATRIX MGetRotY(float YAxisRotate)
+	{
+		MATRIX result = MGetIdent();
+		float sin = std::sin(YAxisRotate);
+		float cos = std::cos(YAxisRotate);
+		result.m[0][0] = cos;
+		result.m[0][2] = -sin;
+		result.m[2][0] = sin;
+		result.m[2][2] = cos;
+		return result;
+	}
+
+	MATRIX MGetScale(VECTOR Scale)
+	{
+		MATRIX result = MGetIdent();
+		result.m[0][0] = Scale.x;
+		result.m[1][1] = Scale.y;
+		result.m[2][2] = Scale.z;
+		return result;
+	}
+
+	MATRIX MGetTranslate(VECTOR Trans)
+	{
+		MATRIX result = MGetIdent();
+		result.m[3][0] = Trans.x;
+		result.m[3][1] = Trans.y;
+		result.m[3][2] = Trans.z;
+		return result;
+	}
+
+	MATRIX MMult(MATRIX In1, MATRIX In2)
+	{
+		MATRIX result = {};
+		for (int i = 0; i < 4; i++) {
+			for (int j = 0; j < 4; j++) {
+				for (int k = 0; k < 4; k++) {
+					result.m[i][j] += In1.m[i][k] * In2.m[k][j];
+				}
+			}
+		}
+		return result;
+	}
+
+	// EI
+
+	int DxLib_Init() { return 0; }
+	int DxLib_End() { return 0; }
+	int ProcessMessage() { return 0; }
+	int ChangeWindowMode(int) { return 0; }
+	int SetWindowTextDX(const TCHAR*) { return 0; }
+	int SetWindowSize(int, int) { return 0; }
+	int SetGraphMode(int, int, int, int) { return 0; }
+	int SetUseDirect3DVersion(int) { return 0; }
+	int SetAlwaysRunFlag(int) { return 0; }
+	int SetWaitVSyncFlag(int) { return 0; }
+	int SetChangeScreenModeGraphicsSystemResetFlag(int) { return 0; }
+	int SetMouseDispFlag(int) { return 0; }
+	int GetWindowActiveFlag() { return FALSE; }
+	const void* GetUseDirect3D11DeviceContext() { return nullptr; }
+
+	// EEO
+
+	LONGLONG GetNowHiPerformanceCount(int)
+	{
+		return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	int GetRand(int RandMax)
+	{
+		if (RandMax <= 0) return 0;
+		return std::uniform_int_distribution<int>(0, RandMax)(g_random);
+	}
+
+	int LogFileFmtAdd(const TCHAR* FormatString, ...)
+	{
+		// Ot@C̑ɕWo͂ɏo
+		va_list args;
+		va_start(args, FormatString);
+		std::vprintf(FormatString, args);
+		va_end(args);
+		std::putchar('\n');
+		return 0;
+	}
+
+	// t@C
+
+	LONGLONG FileRead_size(const TCHAR* FilePath)
+	{
+		std::error_code error;
+		auto size = std::filesystem::file_size(FilePath, error);
+		return error ? -1 : static_cast<LONGLONG>(size);
+	}
+
+	// 񓯊ǂݍ(ׂĂ̏œǂݍݏIƂɂ)
+
+	int SetUseASyncLoadFlag(int) { return 0; }
+	int SetASyncLoadThreadNum(int) { return 0; }
+	int CheckHandleASyncLoad(int) { return FALSE; }
+
+	// `
+
+	int SetDrawScreen(int DrawScreen)
+	{
+		g_drawScreen = DrawScreen;
+		return 0;
+	}
+
+	int GetDrawScreen() { return g_drawScreen; }
+	int ClearDrawScreen(const RECT*) { return 0; }
+	int ScreenFlip() { return 0; }
+	int RenderVertex() { return 0; }
+	int SetBackgroundColor(int, int, int, int) { return 0; }
+	int SetDrawArea(int, int, int, int) { return 0; }
+	int SetDrawMode(int) { return 0; }
+	int GetDrawMode() { return DX_DRAWMODE_NEAREST; }
+	int SetTextureAddressMode(int, int) { return 0; }
+
+	int GetDrawArea(RECT* Rect)
+	{
+		*Rect = RECT{ 0, 0, 0, 0 };
+		return 0;
+	}
+	int SetDrawBlendMode(int, int) { return 0; }
+	int SetUseZBuffer3D(int) { return 0; }
+	int SetWriteZBuffer3D(int) { return 0; }
+	int SetUseBackCulling(int) { return 0; }
+
+	int GetDrawScreenSize(int* XBuf, int* YBuf)
+	{
+		*XBuf = 0;
+		*YBuf = 0;
+		return 0;
+	}
+
+	int GetDrawScreenGraph(int, int, int, int, int, int) { return 0; }
+
+	COLOR_F GetColorF(float Red, float Green, float Blue, float Alpha)
+	{
+		return COLOR_F{ Red, Green, Blue, Alpha };
+	}
+
+	COLOR_U8 GetColorU8(int Red, int Green, int Blue, int Alpha)
+	{
+		return COLOR_U8{ static_cast<unsigned char>(Blue), static_cast<unsigned char>(Green), static_cast<unsigned char>(Red), static_cast<unsigned char>(Alpha) };
+	}
+
+	// 摜(nhԂA傫0Ƃ)
+
+	int LoadGraph(const TCHAR*, int) { return NewHandle(); }
+	int MakeGraph(int, int, int) { return NewHandle(); }
+	int MakeScreen(int, int, int) { return NewHandle(); }
+	int DerivationGraph(int, int, int, int, int) { return NewHandle(); }
+	int DeleteGraph(int, int) { return 0; }
+
+	int GetGraphSize(int, int* SizeXBuf, int* SizeYBuf)
+	{
+		*SizeXBuf = 0;
+		*SizeYBuf = 0;
+		return 0;
+	}
+
+	int GetGraphTextureSize(int, int* SizeXBuf, int* SizeYBuf)
+	{
+		*SizeXBuf = 0;
+		*SizeYBuf = 0;
+		return 0;
+	}
+
+	int DrawGraph(int, int, int, int) { return 0; }
+	int DrawExtendGraph(int, int, int, int, int, int) { return 0; }
+	int DrawRotaGraph(int, int, double, double, int, int, int, int) { return 0; }
+	int DrawPolygon2D(const VERTEX2D*, int, int, int) { return 0; }
+	int DrawBox(int, int, int, int, unsigned int, int) { return 0; }
+	int DrawString(int, int, const TCHAR*, unsigned int, unsigned int) { return 0; }
+	int DrawFormatString(int, int, unsigned int, const TCHAR*, ...) { return 0; }
+
+	// 3D`
+
+	int DrawLine3D(VECTOR, VECTOR, unsigned int) { return 0; }
+	int DrawSphere3D(VECTOR, float, int, unsigned int, unsigned int, int) { return 0; }
+	int DrawPolygon3D(const VERTEX3D*, int, int, int) { return 0; }
+	int DrawCapsule3D(VECTOR, VECTOR, float, int, unsigned int, unsigned int, int) { return 0; }
+
+	// J(ʒuƒ_ƃjAt@[oĂ)
+
+	int SetCameraNearFar(float Near, float Far)
+	{
+		g_cameraNear = Near;
+		g_cameraFar = Far;
+		return 0;
+	}
+
+	int SetCameraPositionAndTarget_UpVecY(VECTOR Position, VECTOR Target)
+	{
+		g_cameraPosition = Position;
+		g_cameraTarget = Target;
+		return 0;
+	}
+
+	int SetCameraPositionAndTargetAndUpVec(VECTOR Position, VECTOR TargetPosition, VECTOR)
+	{
+		g_cameraPosition = Position;
+		g_cameraTarget = TargetPosition;
+		return 0;
+	}
+
+	int SetCameraScreenCenter(float, float) { return 0; }
+	int SetupCamera_Perspective(float) { return 0; }
+
+	int GetCameraScreenCenter(float* x, float* y)
+	{
+		*x = 0.0f;
+		*y = 0.0f;
+		return 0;
+	}
+
+	float GetCameraNear() { return g_cameraNear; }
+	float GetCameraFar() { return g_cameraFar; }
+	int SetCameraViewMatrix(MATRIX) { return 0; }
+	int SetupCamera_ProjectionMatrix(MATRIX) { return 0; }
+
+	VECTOR GetCameraPosition()
+	{
+		return g_cameraPosition;
+	}
+
+	VECTOR GetCameraFrontVector()
+	{
+		VECTOR front = VSub(g_cameraTarget, g_cameraPosition);
+		float size = VSize(front);
+		return size > 0.0f ? VScale(front, 1.0f / size) : VGet(0.0f, 0.0f, 1.0f);
+	}
+
+	MATRIX GetCameraViewMatrix() { return MGetIdent(); }
+	MATRIX GetCameraProjectionMatrix() { return MGetIdent(); }
+
+	// Cg
+
+	int SetUseLighting(int) { return 0; }
+	int SetLightDifColor(COLOR_F) { return 0; }
+	int SetLightDirection(VECTOR) { return 0; }
+	int CreateDirLightHandle(VECTOR) { return NewHandle(); }
+	int SetLightDifColorHandle(int, COLOR_F) { return 0; }
+	int SetLightDirectionHandle(int, VECTOR) { return 0; }
+	int DeleteLightHandle(int) { return 0; }
+	int DeleteLightHandleAll() { return 0; }
+
+	// f(ʒuoĂAt[̈ʒu̓f̈ʒuőウ)
+
+	int MV1LoadModel(const TCHAR*) { return NewHandle(); }
+	int MV1DuplicateModel(int) { return NewHandle(); }
+
+	int MV1DeleteModel(int MHandle)
+	{
+		std::lock_guard<std::mutex> lock(g_modelMutex);
+		g_modelPosition.erase(MHandle);
+		return 0;
+	}
+
+	int MV1DrawModel(int) { return 0; }
+
+	int MV1SetPosition(int MHandle, VECTOR Position)
+	{
+		std::lock_guard<std::mutex> lock(g_modelMutex);
+		g_modelPosition[MHandle] = Position;
+		return 0;
+	}
+
+	int MV1SetScale(int, VECTOR) { return 0; }
+
+	int MV1SetMatrix(int MHandle, MATRIX Matrix)
+	{
+		std::lock_guard<std::mutex> lock(g_modelMutex);
+		g_modelPosition[MHandle] = VGet(Matrix.m[3][0], Matrix.m[3][1], Matrix.m[3][2]);
+		return 0;
+	}
+
+	VECTOR MV1GetFramePosition(int MHandle, int)
+	{
+		std::lock_guard<std::mutex> lock(g_modelMutex);
+		auto it = g_modelPosition.find(MHandle);
+		return it != g_modelPosition.end() ? it->second : VGet(0.0f, 0.0f, 0.0f);
+	}
+
+	int MV1GetTextureNum(int) { return 0; }
+	int MV1GetTextureGraphHandle(int, int) { return -1; }
+	int MV1SetTextureGraphHandle(int, int, int, int) { return 0; }
+	int MV1AttachAnim(int, int, int, int) { return 0; }
+	int MV1DetachAnim(int, int) { return 0; }
+	float MV1GetAttachAnimTotalTime(int, int) { return NULL_ANIM_TOTAL_TIME; }
+	int MV1SetAttachAnimTime(int, int, float) { return 0; }
+	int MV1SetAttachAnimBlendRate(int, int, float) { return 0; }
+
+	// TEh(炳AɖIĂ邱Ƃɂ)
+
+	int SetCreateSoundDataType(int) { return 0; }
+	int LoadSoundMem(const TCHAR*, int, int) { return NewHandle(); }
+	int LoadBGM(const TCHAR*) { return NewHandle(); }
+	int DuplicateSoundMem(int, int) { return NewHandle(); }
+	int PlaySoundMem(int, int, int) { return 0; }
+	int StopSoundMem(int, int) { return 0; }
+	int CheckSoundMem(int) { return 0; }
+	int ChangeVolumeSoundMem(int, int) { return 0; }
+
+	// (pbhEL[{[hE}EX͂ȂĂȂƂɂ)
+
+	int GetJoypadNum() { return 0; }
+
+	int GetJoypadXInputState(int, XINPUT_STATE* XInputState)
+	{
+		*XInputState = {};
+		return -1;
+	}
+
+	int CheckHitKey(int) { return 0; }
+	int GetMouseInput() { return 0; }
+
+	int GetMousePoint(int* XBuf, int* YBuf)
+	{
+		*XBuf = 0;
+		*YBuf = 0;
+		return 0;
+	}
+
+	int SetMousePoint(int, int) { return 0; }
+}
@@ -0,0 +1,4 @@
+#pragma once
+
+// EBhEȂŃQ[̍XVs߂́AEffekseeȓ̃wb_[
+// Q[EffekseerForDXLib̊֐ĝŁAg͂Ȃ
@@ -0,0 +1,17 @@
+#pragma once
+
+// EBhEȂŃQ[̍XVs߂́AEffekseerForDXLib̑̃wb_[
+// GtFNg͍ĐAĐɏIƂɂ(EffekseerNull.cpp)
+
+int Effekseer_Init(int particleMax, int a = 0, bool b = true);
+void Effkseer_End();
+void Effekseer_Sync3DSetting();
+int UpdateEffekseer3D();
+int DrawEffekseer3D();
+int LoadEffekseerEffect(const char* fileName, float magnification = 1.0f);
+int DeleteEffekseerEffect(int effectResourceHandle);
+int PlayEffekseer3DEffect(int effectResourceHandle);
+int StopEffekseer3DEffect(int playingEffecHandle);
+int IsEffekseer3DEffectPlaying(int playingEffectHandle);
+int SetPosPlayingEffekseer3DEffect(int playingEffectHandle, float x, float y, float z);
+int SetScalePlayingEffekseer3DEffect(int playingEffectHandle, float x, float y, float z);
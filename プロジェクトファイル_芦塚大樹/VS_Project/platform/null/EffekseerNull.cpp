@@ -0,0 +1,23 @@
+#include "EffekseerForDXLib.h"
+#include <atomic>
+
+namespace {
+	// GtFNgƍĐɐUnh(ǂݍ݂ɎsɂȂȂ悤A0珇ɐU)
+	std::atomic<int> g_effectHandleCount = 0;
+}
+
+int Effekseer_Init(int, int, bool) { return 0; }
+void Effkseer_End() {}
+void Effekseer_Sync3DSetting() {}
+int UpdateEffekseer3D() { return 0; }
+int DrawEffekseer3D() { return 0; }
+int LoadEffekseerEffect(const char*, float) { return g_effectHandleCount++; }
+int DeleteEffekseerEffect(int) { return 0; }
+int PlayEffekseer3DEffect(int) { return g_effectHandleCount++; }
+int StopEffekseer3DEffect(int) { return 0; }
+
+// ĐĂȂ(-1)ԂāAĐgɋ󂯂
+int IsEffekseer3DEffectPlaying(int) { return -1; }
+
+int SetPosPlayingEffekseer3DEffect(int, float, float, float) { return 0; }
+int SetScalePlayingEffekseer3DEffect(int, float, float, float) { return 0; }
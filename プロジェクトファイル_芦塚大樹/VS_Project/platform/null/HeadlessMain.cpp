@@ -0,0 +1,17 @@
+#include "DxLib.h"
+#include "Application.h"
+#include "TraceRecorder.h"
+
+// EBhEȂőΐJԂƂ̃Gg[|Cg(CMakeLists.txtOtoshiKingHeadless)
+// datatH_̂tH_(VS_Project)N
+int main()
+{
+	// NԂ̋L^n߂
+	TraceRecorder::GetInstance();
+
+	auto& application = Application::GetInstance();
+	if (!application.Init()) return -1;
+
+	// Đ킪1ڂƈႤʂɂȂ玸sŏI
+	return application.RunHeadless() ? 0 : 1;
+}
@@ -0,0 +1,445 @@
+# -*- coding: utf-8 -*-
+"""
+PNGのテクスチャをGPUのブロック圧縮形式(BC1/BC3)のDDSに変換するツール
+
+ゲーム側は ArchiveManager が画像を開くときに同じ名前の .dds があればそちらを読むので、
+変換したものはコードを変えずに使われる(DxLibは中身で形式を判断する)。
+DDSはCPUでの展開がいらず、VRAMにも圧縮したまま置かれるので、読み込みが速くVRAMも1/4～1/8になる。
+DDSがなければ今まで通りPNGを読むので、開発中は変換しなくてよい。
+
+使い方(VS_Projectフォルダで実行):
+    python tools/dds.py convert                 既定のフォルダのPNGを変換する(新しいものだけ)
+    python tools/dds.py convert --force         すべて変換し直す
+    python tools/dds.py convert --texconv PATH  DirectXTexのtexconvがあればそれで変換する(画質がよい)
+    python tools/dds.py clean                   変換したDDSを削除する
+
+形式:
+    不透明な画像はBC1(DXT1, 4bit/画素)、透明がある画像はBC3(DXT5, 8bit/画素)にする。
+    モデルとエフェクトのテクスチャは縮小して描かれるのでミップマップを付ける。
+    UIの画像は等倍で描くのでミップマップは付けない(付けるとVRAMが1/3増える)。
+    アトラスのページ(pack_atlas.pyで作るもの)はUIの画像の大半が入っていて、縮小して描くものもあるのでミップマップを付ける。
+    D3D11は幅と高さが4の倍数でないブロック圧縮テクスチャを作れないので、そうでない画像は右と下を広げてから変換する
+    (透明がある画像は透明で、ない画像は端の画素を引き伸ばして埋める。広げた画像はログに出す)。
+
+外部ライブラリは使わず、PNGの展開もBC1/BC3の圧縮も標準ライブラリだけで行う。
+"""
+import argparse
+import os
+import struct
+import subprocess
+import sys
+import tempfile
+import zlib
+from concurrent.futures import ProcessPoolExecutor
+
+# 変換するフォルダと、ミップマップを付けるかどうか
+DEFAULT_DIRS = {
+    'data/image': False,
+    'data/atlas': True,
+    'data/model': True,
+    'data/effect/Texture': True,
+}
+
+PNG_SIGNATURE = b'\x89PNG\r\n\x1a\n'
+
+# DDSのヘッダ(DDS_HEADER)に使う値
+DDSD_CAPS = 0x1
+DDSD_HEIGHT = 0x2
+DDSD_WIDTH = 0x4
+DDSD_PIXELFORMAT = 0x1000
+DDSD_MIPMAPCOUNT = 0x20000
+DDSD_LINEARSIZE = 0x80000
+DDPF_FOURCC = 0x4
+DDSCAPS_COMPLEX = 0x8
+DDSCAPS_TEXTURE = 0x1000
+DDSCAPS_MIPMAP = 0x400000
+
+
+def paeth(a, b, c):
+    p = a + b - c
+    pa = abs(p - a)
+    pb = abs(p - b)
+    pc = abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    if pb <= pc:
+        return b
+    return c
+
+
+def read_png(path):
+    """PNGを読み込み、(幅, 高さ, RGBAのbytearray)を返す(8bit・インターレースなしのみ)"""
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:8] != PNG_SIGNATURE:
+        raise ValueError('PNGではありません')
+
+    pos = 8
+    idat = bytearray()
+    palette = b''
+    transparency = b''
+    while pos < len(data):
+        length, kind = struct.unpack_from('>I4s', data, pos)
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b'IHDR':
+            width, height, depth, color, _, _, interlace = struct.unpack('>IIBBBBB', body)
+        elif kind == b'PLTE':
+            palette = body
+        elif kind == b'tRNS':
+            transparency = body
+        elif kind == b'IDAT':
+            idat += body
+        elif kind == b'IEND':
+            break
+
+    if depth != 8 or interlace != 0:
+        raise ValueError('8bit・インターレースなし以外には対応していません')
+
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color]
+    stride = width * channels
+    raw = zlib.decompress(bytes(idat))
+
+    # フィルタを戻す
+    pixels = bytearray(stride * height)
+    previous = bytearray(stride)
+    pos = 0
+    for y in range(height):
+        kind = raw[pos]
+        line = bytearray(raw[pos + 1:pos + 1 + stride])
+        pos += 1 + stride
+        if kind == 1:
+            for i in range(channels, stride):
+                line[i] = (line[i] + line[i - channels]) & 255
+        elif kind == 2:
+            for i in range(stride):
+                line[i] = (line[i] + previous[i]) & 255
+        elif kind == 3:
+            for i in range(stride):
+                left = line[i - channels] if i >= channels else 0
+                line[i] = (line[i] + ((left + previous[i]) >> 1)) & 255
+        elif kind == 4:
+            for i in range(stride):
+                left = line[i - channels] if i >= channels else 0
+                upper_left = previous[i - channels] if i >= channels else 0
+                line[i] = (line[i] + paeth(left, previous[i], upper_left)) & 255
+        pixels[y * stride:(y + 1) * stride] = line
+        previous = line
+
+    # RGBAにそろえる
+    if color == 6:
+        return width, height, pixels
+    rgba = bytearray(width * height * 4)
+    if color == 2:
+        key = struct.unpack('>HHH', transparency) if len(transparency) == 6 else None
+        for i in range(width * height):
+            r, g, b = pixels[i * 3:i * 3 + 3]
+            alpha = 0 if key is not None and (r, g, b) == key else 255
+            rgba[i * 4:i * 4 + 4] = bytes((r, g, b, alpha))
+    elif color == 3:
+        for i, index in enumerate(pixels):
+            alpha = transparency[index] if index < len(transparency) else 255
+            rgba[i * 4:i * 4 + 4] = palette[index * 3:index * 3 + 3] + bytes((alpha,))
+    elif color == 0:
+        for i, value in enumerate(pixels):
+            rgba[i * 4:i * 4 + 4] = bytes((value, value, value, 255))
+    elif color == 4:
+        for i in range(width * height):
+            value, alpha = pixels[i * 2:i * 2 + 2]
+            rgba[i * 4:i * 4 + 4] = bytes((value, value, value, alpha))
+    return width, height, rgba
+
+
+def half_size(width, height, rgba):
+    """2x2の平均で半分の大きさの画像を作る(ミップマップ用)"""
+    new_width = max(1, width // 2)
+    new_height = max(1, height // 2)
+    out = bytearray(new_width * new_height * 4)
+    for y in range(new_height):
+        y0 = min(y * 2, height - 1) * width
+        y1 = min(y * 2 + 1, height - 1) * width
+        for x in range(new_width):
+            x0 = min(x * 2, width - 1)
+            x1 = min(x * 2 + 1, width - 1)
+            a = (y0 + x0) * 4
+            b = (y0 + x1) * 4
+            c = (y1 + x0) * 4
+            d = (y1 + x1) * 4
+            o = (y * new_width + x) * 4
+            for k in range(4):
+                out[o + k] = (rgba[a + k] + rgba[b + k] + rgba[c + k] + rgba[d + k] + 2) >> 2
+    return new_width, new_height, out
+
+
+def align4(value):
+    return (value + 3) & ~3
+
+
+def pad_to_block(width, height, rgba, has_alpha):
+    """幅と高さを4の倍数に広げる(透明がある画像は透明で、ない画像は端の画素を引き伸ばして埋める)"""
+    new_width = align4(width)
+    new_height = align4(height)
+    out = bytearray(new_width * new_height * 4)
+    for y in range(new_height):
+        if has_alpha and y >= height:
+            continue
+        line = rgba[min(y, height - 1) * width * 4:(min(y, height - 1) + 1) * width * 4]
+        fill = bytes((new_width - width) * 4) if has_alpha else line[-4:] * (new_width - width)
+        out[y * new_width * 4:(y + 1) * new_width * 4] = line + fill
+    return new_width, new_height, out
+
+
+def write_png(path, width, height, rgba):
+    """RGBAのbytearrayをPNGとして書き出す(texconvに広げた画像を渡すときに使う)"""
+    stride = width * 4
+    raw = bytearray()
+    for y in range(height):
+        raw.append(0)
+        raw += rgba[y * stride:(y + 1) * stride]
+
+    def chunk(kind, body):
+        return struct.pack('>I', len(body)) + kind + body + struct.pack('>I', zlib.crc32(kind + body) & 0xffffffff)
+
+    with open(path, 'wb') as f:
+        f.write(PNG_SIGNATURE)
+        f.write(chunk(b'IHDR', struct.pack('>IIBBBBB', width, height, 8, 6, 0, 0, 0)))
+        f.write(chunk(b'IDAT', zlib.compress(bytes(raw), 9)))
+        f.write(chunk(b'IEND', b''))
+
+
+def read_block_aligned(path):
+    """PNGを読み込み、4の倍数に広げて(幅, 高さ, RGBA, 透明があるか, 広げたときのログ)を返す"""
+    width, height, rgba = read_png(path)
+    has_alpha = any(rgba[i] != 255 for i in range(3, len(rgba), 4))
+    if width % 4 == 0 and height % 4 == 0:
+        return width, height, rgba, has_alpha, ''
+
+    new_width, new_height, rgba = pad_to_block(width, height, rgba, has_alpha)
+    return new_width, new_height, rgba, has_alpha, f'パディング {path}: {width}x{height} -> {new_width}x{new_height}\n'
+
+
+def to_565(r, g, b):
+    return ((r * 31 + 127) // 255) << 11 | ((g * 63 + 127) // 255) << 5 | ((b * 31 + 127) // 255)
+
+
+def from_565(value):
+    r = (value >> 11) & 31
+    g = (value >> 5) & 63
+    b = value & 31
+    return (r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)
+
+
+def encode_color_block(block):
+    """16画素分のRGBからBC1のカラーブロック(8byte)を作る(4色モード)"""
+    # 各成分の最小値と最大値を端点にし、少し内側に寄せる
+    low = [min(p[k] for p in block) for k in range(3)]
+    high = [max(p[k] for p in block) for k in range(3)]
+    inset = [(high[k] - low[k]) >> 4 for k in range(3)]
+    low = [min(255, low[k] + inset[k]) for k in range(3)]
+    high = [max(0, high[k] - inset[k]) for k in range(3)]
+
+    color0 = to_565(*high)
+    color1 = to_565(*low)
+    if color0 < color1:
+        color0, color1 = color1, color0
+    if color0 == color1:
+        return struct.pack('<HHI', color0, color1, 0)
+
+    c0 = from_565(color0)
+    c1 = from_565(color1)
+    palette = (
+        c0,
+        c1,
+        tuple((2 * c0[k] + c1[k]) // 3 for k in range(3)),
+        tuple((c0[k] + 2 * c1[k]) // 3 for k in range(3)),
+    )
+
+    indices = 0
+    for i, p in enumerate(block):
+        best = 0
+        best_distance = None
+        for n, q in enumerate(palette):
+            distance = (p[0] - q[0]) ** 2 + (p[1] - q[1]) ** 2 + (p[2] - q[2]) ** 2
+            if best_distance is None or distance < best_distance:
+                best = n
+                best_distance = distance
+        indices |= best << (i * 2)
+    return struct.pack('<HHI', color0, color1, indices)
+
+
+def encode_alpha_block(alphas):
+    """16画素分のアルファからBC3のアルファブロック(8byte)を作る(8段階モード)"""
+    alpha0 = max(alphas)
+    alpha1 = min(alphas)
+    if alpha0 == alpha1:
+        return bytes((alpha0, alpha1)) + bytes(6)
+
+    levels = [alpha0, alpha1] + [((7 - n) * alpha0 + n * alpha1) // 7 for n in range(1, 7)]
+    bits = 0
+    for i, a in enumerate(alphas):
+        best = min(range(8), key=lambda n: abs(levels[n] - a))
+        bits |= best << (i * 3)
+    return bytes((alpha0, alpha1)) + bits.to_bytes(6, 'little')
+
+
+def encode_level(width, height, rgba, has_alpha):
+    """1段分の画像をブロックごとに圧縮する(端のブロックは端の画素で埋める)"""
+    out = bytearray()
+    for by in range(0, height, 4):
+        for bx in range(0, width, 4):
+            block = []
+            for y in range(4):
+                row = min(by + y, height - 1) * width
+                for x in range(4):
+                    o = (row + min(bx + x, width - 1)) * 4
+                    block.append(rgba[o:o + 4])
+            if has_alpha:
+                out += encode_alpha_block([p[3] for p in block])
+            out += encode_color_block(block)
+    return out
+
+
+def dds_header(width, height, level_num, has_alpha, top_size):
+    flags = DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT | DDSD_LINEARSIZE
+    caps = DDSCAPS_TEXTURE
+    if level_num > 1:
+        flags |= DDSD_MIPMAPCOUNT
+        caps |= DDSCAPS_COMPLEX | DDSCAPS_MIPMAP
+
+    header = struct.pack('<7I', 124, flags, height, width, top_size, 0, level_num)
+    header += bytes(4 * 11)
+    header += struct.pack('<2I4s5I', 32, DDPF_FOURCC, b'DXT5' if has_alpha else b'DXT1', 0, 0, 0, 0, 0)
+    header += struct.pack('<5I', caps, 0, 0, 0, 0)
+    return b'DDS ' + header
+
+
+def dds_path(path):
+    return os.path.splitext(path)[0] + '.dds'
+
+
+def convert_builtin(path, mipmap):
+    """標準ライブラリだけでPNGをDDSに変換する"""
+    width, height, rgba, has_alpha, log = read_block_aligned(path)
+
+    levels = []
+    level_width, level_height, level_rgba = width, height, rgba
+    while True:
+        levels.append(encode_level(level_width, level_height, level_rgba, has_alpha))
+        if not mipmap or (level_width == 1 and level_height == 1):
+            break
+        level_width, level_height, level_rgba = half_size(level_width, level_height, level_rgba)
+
+    with open(dds_path(path), 'wb') as f:
+        f.write(dds_header(width, height, len(levels), has_alpha, len(levels[0])))
+        for level in levels:
+            f.write(level)
+
+    before = width * height * 4
+    after = sum(len(level) for level in levels)
+    return f"{log}{'BC3' if has_alpha else 'BC1'} {path}: {before // 1024} KB -> {after // 1024} KB"
+
+
+def convert_texconv(texconv, path, mipmap):
+    """DirectXTexのtexconvでPNGをDDSに変換する(DxLibが読めるよう旧形式のヘッダで出す)"""
+    width, height, rgba, has_alpha, log = read_block_aligned(path)
+
+    with tempfile.TemporaryDirectory() as temp:
+        # 広げた画像は同じ名前で一時フォルダに書き出して渡す(出力の名前は入力の名前で決まる)
+        source = path
+        if log:
+            source = os.path.join(temp, os.path.basename(path))
+            write_png(source, width, height, rgba)
+
+        command = [texconv, '-nologo', '-y', '-dx9',
+                   '-f', 'BC3_UNORM' if has_alpha else 'BC1_UNORM',
+                   '-m', '0' if mipmap else '1',
+                   '-o', os.path.dirname(path) or '.', source]
+        subprocess.run(command, check=True, stdout=subprocess.DEVNULL)
+    return f"{log}{'BC3' if has_alpha else 'BC1'} {path} (texconv)"
+
+
+def convert_one(job):
+    path, mipmap, texconv = job
+    try:
+        if texconv:
+            return convert_texconv(texconv, path, mipmap)
+        return convert_builtin(path, mipmap)
+    except (ValueError, KeyError, OSError, subprocess.CalledProcessError) as error:
+        return f'NG  {path}: {error}'
+
+
+def collect_files(dirs):
+    """変換するPNGと、ミップマップを付けるかどうかを集める"""
+    files = []
+    for directory, mipmap in dirs.items():
+        for root, _, names in os.walk(directory):
+            for name in sorted(names):
+                if name.lower().endswith('.png'):
+                    files.append((os.path.join(root, name).replace('\\', '/'), mipmap))
+    return sorted(files)
+
+
+def target_dirs(args):
+    if not args.dirs:
+        return DEFAULT_DIRS
+    return {directory: not args.no_mipmap for directory in args.dirs}
+
+
+def command_convert(args):
+    jobs = []
+    for path, mipmap in collect_files(target_dirs(args)):
+        # DDSの方が新しければ変換し直さない
+        output = dds_path(path)
+        if not args.force and os.path.exists(output) and os.path.getmtime(output) >= os.path.getmtime(path):
+            continue
+        jobs.append((path, mipmap, args.texconv))
+
+    if not jobs:
+        print('変換するものはありません')
+        return 0
+
+    errors = 0
+    with ProcessPoolExecutor(max_workers=args.jobs) as executor:
+        for message in executor.map(convert_one, jobs):
+            if message.startswith('NG'):
+                errors += 1
+            print(message)
+
+    print(f'{len(jobs)} ファイル中 {errors} 件のエラー')
+    return 1 if errors else 0
+
+
+def command_clean(args):
+    removed = 0
+    for path, _ in collect_files(target_dirs(args)):
+        output = dds_path(path)
+        if os.path.exists(output):
+            os.remove(output)
+            removed += 1
+    print(f'{removed} ファイルを削除しました')
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description='PNGのテクスチャをBC1/BC3のDDSに変換する')
+    sub = parser.add_subparsers(dest='command', required=True)
+
+    convert = sub.add_parser('convert', help='DDSに変換する')
+    convert.add_argument('dirs', nargs='*', help='変換するフォルダ(省略時は data/image などの既定のフォルダ)')
+    convert.add_argument('--force', action='store_true', help='DDSが新しくても変換し直す')
+    convert.add_argument('--no-mipmap', action='store_true', help='フォルダを指定したときにミップマップを付けない')
+    convert.add_argument('--texconv', help='texconv.exeのパス(指定すると変換をtexconvに任せる)')
+    convert.add_argument('--jobs', type=int, default=os.cpu_count(), help='同時に変換する数')
+    convert.set_defaults(func=command_convert)
+
+    clean = sub.add_parser('clean', help='変換したDDSを削除する')
+    clean.add_argument('dirs', nargs='*', help='削除するフォルダ(省略時は既定のフォルダ)')
+    clean.add_argument('--no-mipmap', action='store_true', help=argparse.SUPPRESS)
+    clean.set_defaults(func=command_clean)
+
+    args = parser.parse_args()
+    return args.func(args)
+
+
+if __name__ == '__main__':
+    sys.exit(main())
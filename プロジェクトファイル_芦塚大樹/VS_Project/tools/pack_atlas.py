@@ -0,0 +1,249 @@
+# -*- coding: utf-8 -*-
+"""
+UI画像をテクスチャアトラスにまとめるツール
+
+data/image 以下の小さいPNGをページ画像(data/atlas/AtlasN.png)に詰め込み、
+各画像の切り出し範囲をインデックス(data/atlas/AtlasIndex.csv)に書き出す。
+ゲーム側は AtlasManager がインデックスを読んで元のパスからページ内の範囲を引く。
+
+使い方(VS_Projectフォルダで実行):
+    python tools/pack_atlas.py
+    python tools/pack_atlas.py --page-size 2048 --max-size 600 --padding 4
+
+ページはdds.pyでBC1/BC3に圧縮するので、4x4のブロックが別の画像にまたがらないようにする。
+画像はページの4の倍数の位置に置き、幅と高さも4の倍数まで余白を広げる(余白は4の倍数にする)。
+
+外部ライブラリは使わず、標準ライブラリ(zlib)だけでPNGを読み書きする。
+"""
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+PNG_SIGNATURE = b'\x89PNG\r\n\x1a\n'
+
+
+def read_png(path):
+    """8bitのRGB/RGBA/グレースケールPNGを読み込み、(幅, 高さ, RGBAのbytearray)を返す"""
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:8] != PNG_SIGNATURE:
+        raise ValueError(f'{path}: PNGではありません')
+
+    pos = 8
+    width = height = 0
+    bit_depth = color_type = interlace = 0
+    palette = b''
+    trns = b''
+    idat = bytearray()
+    while pos < len(data):
+        length, = struct.unpack('>I', data[pos:pos + 4])
+        kind = data[pos + 4:pos + 8]
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b'IHDR':
+            width, height, bit_depth, color_type, _, _, interlace = struct.unpack('>IIBBBBB', body)
+        elif kind == b'PLTE':
+            palette = body
+        elif kind == b'tRNS':
+            trns = body
+        elif kind == b'IDAT':
+            idat += body
+        elif kind == b'IEND':
+            break
+
+    if bit_depth != 8 or interlace != 0:
+        raise ValueError(f'{path}: 8bitの非インターレース画像のみ対応しています')
+
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color_type]
+    stride = width * channels
+    raw = zlib.decompress(bytes(idat))
+
+    # フィルタを戻す
+    pixels = bytearray(stride * height)
+    prev = bytearray(stride)
+    src = 0
+    for y in range(height):
+        filter_type = raw[src]
+        line = bytearray(raw[src + 1:src + 1 + stride])
+        src += 1 + stride
+        if filter_type == 1:
+            for i in range(channels, stride):
+                line[i] = (line[i] + line[i - channels]) & 0xff
+        elif filter_type == 2:
+            line = bytearray((a + b) & 0xff for a, b in zip(line, prev))
+        elif filter_type == 3:
+            for i in range(stride):
+                left = line[i - channels] if i >= channels else 0
+                line[i] = (line[i] + ((left + prev[i]) >> 1)) & 0xff
+        elif filter_type == 4:
+            for i in range(stride):
+                a = line[i - channels] if i >= channels else 0
+                b = prev[i]
+                c = prev[i - channels] if i >= channels else 0
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                if pa <= pb and pa <= pc:
+                    pred = a
+                elif pb <= pc:
+                    pred = b
+                else:
+                    pred = c
+                line[i] = (line[i] + pred) & 0xff
+        pixels[y * stride:(y + 1) * stride] = line
+        prev = line
+
+    # RGBAにそろえる
+    if color_type == 6:
+        return width, height, pixels
+    rgba = bytearray(width * height * 4)
+    for i in range(width * height):
+        if color_type == 2:
+            r, g, b = pixels[i * 3:i * 3 + 3]
+            a = 255
+        elif color_type == 0:
+            r = g = b = pixels[i]
+            a = 255
+        elif color_type == 4:
+            r = g = b = pixels[i * 2]
+            a = pixels[i * 2 + 1]
+        else:
+            index = pixels[i]
+            r, g, b = palette[index * 3:index * 3 + 3]
+            a = trns[index] if index < len(trns) else 255
+        rgba[i * 4:i * 4 + 4] = bytes((r, g, b, a))
+    return width, height, rgba
+
+
+def write_png(path, width, height, rgba):
+    """RGBAのbytearrayをPNGとして書き出す"""
+    stride = width * 4
+    raw = bytearray()
+    for y in range(height):
+        raw.append(0)
+        raw += rgba[y * stride:(y + 1) * stride]
+
+    def chunk(kind, body):
+        return struct.pack('>I', len(body)) + kind + body + struct.pack('>I', zlib.crc32(kind + body) & 0xffffffff)
+
+    with open(path, 'wb') as f:
+        f.write(PNG_SIGNATURE)
+        f.write(chunk(b'IHDR', struct.pack('>IIBBBBB', width, height, 8, 6, 0, 0, 0)))
+        f.write(chunk(b'IDAT', zlib.compress(bytes(raw), 9)))
+        f.write(chunk(b'IEND', b''))
+
+
+def align4(value):
+    return (value + 3) & ~3
+
+
+class Page:
+    """棚詰め(シェルフ)方式で矩形を配置する1ページ"""
+
+    def __init__(self, size):
+        self.size = size
+        self.shelf_y = 0
+        self.shelf_height = 0
+        self.cursor_x = 0
+
+    def used_height(self):
+        return align4(self.shelf_y + self.shelf_height)
+
+    def insert(self, width, height):
+        if width > self.size or height > self.size:
+            return None
+        # 今の棚に入らなければ次の棚へ
+        if self.cursor_x + width > self.size:
+            self.shelf_y += self.shelf_height
+            self.shelf_height = 0
+            self.cursor_x = 0
+        if self.shelf_y + height > self.size:
+            return None
+        pos = (self.cursor_x, self.shelf_y)
+        self.cursor_x += width
+        self.shelf_height = max(self.shelf_height, height)
+        return pos
+
+
+def main():
+    parser = argparse.ArgumentParser(description='UI画像をテクスチャアトラスにまとめる')
+    parser.add_argument('--src', default='data/image', help='元画像のフォルダ')
+    parser.add_argument('--out', default='data/atlas', help='出力先フォルダ')
+    parser.add_argument('--page-size', type=int, default=2048, help='ページの一辺のピクセル数')
+    parser.add_argument('--max-size', type=int, default=600, help='この大きさを超える画像はアトラスに入れない')
+    parser.add_argument('--padding', type=int, default=4, help='拡大縮小時のにじみを防ぐ余白(4の倍数)')
+    args = parser.parse_args()
+
+    if args.padding < 0 or args.padding % 4 != 0:
+        print(f'--padding は4の倍数にしてください({args.padding})')
+        return 1
+
+    # 対象の画像を集める
+    images = []
+    for name in sorted(os.listdir(args.src)):
+        if not name.lower().endswith('.png'):
+            continue
+        path = os.path.join(args.src, name)
+        with open(path, 'rb') as f:
+            head = f.read(24)
+        width, height = struct.unpack('>II', head[16:24])
+        if max(width, height) > args.max_size:
+            continue
+        images.append((name, width, height))
+
+    # 背の高い順に詰めると棚の無駄が少ない
+    images.sort(key=lambda item: (-item[2], -item[1], item[0]))
+
+    pages = []
+    placements = []
+    for name, width, height in images:
+        # 4の倍数の大きさにしておけば、棚の中の位置も4の倍数になる
+        w = align4(width) + args.padding * 2
+        h = align4(height) + args.padding * 2
+        for index, page in enumerate(pages):
+            pos = page.insert(w, h)
+            if pos is not None:
+                break
+        else:
+            pages.append(Page(args.page_size))
+            index = len(pages) - 1
+            pos = pages[index].insert(w, h)
+        placements.append((name, index, pos[0] + args.padding, pos[1] + args.padding, width, height))
+
+    # ページ画像を作る
+    os.makedirs(args.out, exist_ok=True)
+    size = args.page_size
+    canvases = [bytearray(size * page.used_height() * 4) for page in pages]
+    for name, index, x, y, width, height in placements:
+        _, _, rgba = read_png(os.path.join(args.src, name))
+        canvas = canvases[index]
+        pad = args.padding
+        right = align4(width) - width + pad
+        bottom = align4(height) - height + pad
+        for row in range(-pad, height + bottom):
+            # 余白には端のピクセルを引き伸ばしてにじみを防ぐ
+            src_row = min(max(row, 0), height - 1)
+            line = rgba[src_row * width * 4:(src_row + 1) * width * 4]
+            line = line[:4] * pad + line + line[-4:] * right
+            start = ((y + row) * size + x - pad) * 4
+            canvas[start:start + len(line)] = line
+        print(f'  {name} -> Atlas{index} ({x},{y})')
+
+    # 使っていない下側は切り詰めてVRAMを節約する
+    for index, canvas in enumerate(canvases):
+        write_png(os.path.join(args.out, f'Atlas{index}.png'), size, pages[index].used_height(), canvas)
+
+    # インデックスを書き出す(ゲーム側の定数CSVに合わせてShift-JISで書く)
+    src_dir = args.src.replace('\\', '/').rstrip('/')
+    with open(os.path.join(args.out, 'AtlasIndex.csv'), 'w', encoding='cp932', newline='') as f:
+        f.write('画像パス,ページ,X,Y,幅,高さ')
+        for name, index, x, y, width, height in sorted(placements):
+            f.write(f'\n{src_dir}/{name},{args.out.replace(chr(92), "/").rstrip("/")}/Atlas{index}.png,{x},{y},{width},{height}')
+
+    print(f'{len(placements)} 枚を {len(pages)} ページにまとめました')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
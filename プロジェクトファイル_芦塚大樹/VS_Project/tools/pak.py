@@ -0,0 +1,309 @@
+# -*- coding: utf-8 -*-
+"""
+アセットを1つのアーカイブ(data.pak)にまとめる・中身を一覧する・検証するツール
+
+ゲーム側は起動時に ArchiveManager がアーカイブをメモリにマップし、
+DxLibのファイル読み込みを差し替えて元のパスのままアーカイブから読み込む。
+アーカイブがなければフォルダのファイルをそのまま読み込むので、開発中は作らなくてよい。
+
+使い方(VS_Projectフォルダで実行):
+    python tools/pak.py pack                 data/model などをまとめて data.pak を作る
+    python tools/pak.py pack --no-compress   LZ4で圧縮せずにまとめる
+    python tools/pak.py pack --skip-converted  DDSに変換済みの画像は元のPNGを入れない
+    python tools/pak.py list                 入っているファイルを一覧する
+    python tools/pak.py verify               CRCを確かめ、フォルダのファイルとも比べる
+
+形式(リトルエンディアン):
+    ヘッダ   : "PAK1", バージョン(4), ファイル数(4), アライメント(4), インデックス位置(8), インデックスサイズ(8)
+    インデックス: パスの長さ(2), フラグ(2), CRC32(4), データ位置(8), 格納サイズ(8), 展開サイズ(8), パス(Shift-JIS)
+    データ   : アライメントの倍数の位置に置く。フラグの1bit目が立っていればLZ4のブロック形式で圧縮している
+
+外部ライブラリは使わず、LZ4の圧縮・展開も標準ライブラリだけで行う。
+"""
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+MAGIC = b'PAK1'
+VERSION = 1
+HEADER = struct.Struct('<4sIIIQQ')
+ENTRY = struct.Struct('<HHIQQQ')
+FLAG_LZ4 = 1
+
+# まとめるフォルダ(定数CSVはifstreamで読むので入れない)
+DEFAULT_DIRS = ['data/model', 'data/image', 'data/atlas', 'data/BGM', 'data/SE', 'data/effect', 'data/effects']
+
+# ゲームで読み込む拡張子
+PACK_EXTENSIONS = {'.mv1', '.png', '.jpg', '.bmp', '.dds', '.mp3', '.ogg', '.wav', '.efk', '.efkmat', '.efkmodel'}
+
+# すでに圧縮されている形式は圧縮を試さない
+STORE_EXTENSIONS = {'.png', '.jpg', '.mp3', '.ogg'}
+
+# 同じ名前のDDSがあればゲーム側がそちらを読む画像の拡張子(tools/dds.py)
+TEXTURE_EXTENSIONS = {'.png', '.jpg', '.bmp', '.tga'}
+
+# LZ4の決まり(最後の5byteはリテラル、一致は終端から12byte以上前で始める)
+LZ4_LAST_LITERALS = 5
+LZ4_MATCH_LIMIT = 12
+LZ4_MIN_MATCH = 4
+LZ4_MAX_OFFSET = 65535
+
+
+def lz4_write_length(out, value):
+    while value >= 255:
+        out.append(255)
+        value -= 255
+    out.append(value)
+
+
+def lz4_compress(data):
+    """LZ4のブロック形式で圧縮する(貪欲法の簡単な実装)"""
+    size = len(data)
+    out = bytearray()
+    table = {}
+    anchor = 0
+    pos = 0
+    limit = size - LZ4_MATCH_LIMIT
+
+    while pos < limit:
+        key = data[pos:pos + 4]
+        candidate = table.get(key)
+        table[key] = pos
+        if candidate is None or pos - candidate > LZ4_MAX_OFFSET:
+            pos += 1
+            continue
+
+        # 一致を伸ばせるだけ伸ばす
+        length = LZ4_MIN_MATCH
+        max_length = size - LZ4_LAST_LITERALS - pos
+        while length < max_length and data[candidate + length] == data[pos + length]:
+            length += 1
+
+        literal = pos - anchor
+        match = length - LZ4_MIN_MATCH
+        out.append((min(literal, 15) << 4) | min(match, 15))
+        if literal >= 15:
+            lz4_write_length(out, literal - 15)
+        out += data[anchor:pos]
+        out += struct.pack('<H', pos - candidate)
+        if match >= 15:
+            lz4_write_length(out, match - 15)
+
+        pos += length
+        anchor = pos
+
+    # 残りはリテラルだけのシーケンスにする
+    literal = size - anchor
+    out.append(min(literal, 15) << 4)
+    if literal >= 15:
+        lz4_write_length(out, literal - 15)
+    out += data[anchor:]
+    return bytes(out)
+
+
+def lz4_decompress(src, size):
+    """LZ4のブロックを展開する"""
+    out = bytearray()
+    pos = 0
+    while pos < len(src):
+        token = src[pos]
+        pos += 1
+
+        literal = token >> 4
+        if literal == 15:
+            while True:
+                add = src[pos]
+                pos += 1
+                literal += add
+                if add != 255:
+                    break
+        out += src[pos:pos + literal]
+        pos += literal
+        if pos >= len(src):
+            break
+
+        offset = src[pos] | (src[pos + 1] << 8)
+        pos += 2
+        if offset == 0 or offset > len(out):
+            raise ValueError('一致位置が不正です')
+
+        match = token & 15
+        if match == 15:
+            while True:
+                add = src[pos]
+                pos += 1
+                match += add
+                if add != 255:
+                    break
+        match += LZ4_MIN_MATCH
+
+        start = len(out) - offset
+        for i in range(match):
+            out.append(out[start + i])
+
+    if len(out) != size:
+        raise ValueError('展開後のサイズが合いません')
+    return bytes(out)
+
+
+def collect_files(dirs):
+    """まとめるファイルのパスを集める(区切りは'/')"""
+    files = []
+    for directory in dirs:
+        for root, _, names in os.walk(directory):
+            for name in sorted(names):
+                if os.path.splitext(name)[1].lower() in PACK_EXTENSIONS:
+                    files.append(os.path.join(root, name).replace('\\', '/'))
+    return sorted(files)
+
+
+def read_archive(path):
+    """アーカイブを読み込み、(中身, ヘッダ, エントリーのリスト)を返す"""
+    with open(path, 'rb') as f:
+        data = f.read()
+    magic, version, count, alignment, index_offset, index_size = HEADER.unpack_from(data, 0)
+    if magic != MAGIC or version != VERSION:
+        raise ValueError(f'{path}: 対応していない形式です')
+
+    entries = []
+    pos = index_offset
+    for _ in range(count):
+        path_length, flags, crc, offset, stored, size = ENTRY.unpack_from(data, pos)
+        pos += ENTRY.size
+        name = data[pos:pos + path_length].decode('cp932')
+        pos += path_length
+        entries.append({'path': name, 'flags': flags, 'crc': crc, 'offset': offset, 'stored': stored, 'size': size})
+    return data, (alignment, index_offset, index_size), entries
+
+
+def command_pack(args):
+    files = collect_files(args.dirs or DEFAULT_DIRS)
+    if args.skip_converted:
+        # DDSがある画像はゲームから読まれないので入れない
+        converted = set(files)
+        files = [path for path in files
+                 if os.path.splitext(path)[1].lower() not in TEXTURE_EXTENSIONS
+                 or os.path.splitext(path)[0] + '.dds' not in converted]
+    if not files:
+        print('まとめるファイルがありません')
+        return 1
+
+    # 先にデータを用意して、インデックスのサイズを決める
+    blobs = []
+    for path in files:
+        with open(path, 'rb') as f:
+            raw = f.read()
+        stored = raw
+        flags = 0
+        extension = os.path.splitext(path)[1].lower()
+        if not args.no_compress and extension not in STORE_EXTENSIONS and len(raw) > LZ4_MATCH_LIMIT:
+            compressed = lz4_compress(raw)
+            # 効果が薄いものは展開の手間を省くためそのまま入れる
+            if len(compressed) <= len(raw) * (1.0 - args.min_saving):
+                stored = compressed
+                flags |= FLAG_LZ4
+        blobs.append((path, flags, zlib.crc32(raw) & 0xffffffff, raw, stored))
+
+    index_size = sum(ENTRY.size + len(path.encode('cp932')) for path, *_ in blobs)
+    index_offset = HEADER.size
+
+    def align(value):
+        return (value + args.align - 1) // args.align * args.align
+
+    # データの位置を決めてインデックスを作る
+    index = bytearray()
+    offset = align(index_offset + index_size)
+    placements = []
+    for path, flags, crc, raw, stored in blobs:
+        name = path.encode('cp932')
+        index += ENTRY.pack(len(name), flags, crc, offset, len(stored), len(raw)) + name
+        placements.append((offset, stored))
+        offset = align(offset + len(stored))
+
+    with open(args.out, 'wb') as f:
+        f.write(HEADER.pack(MAGIC, VERSION, len(blobs), args.align, index_offset, index_size))
+        f.write(index)
+        for offset, stored in placements:
+            f.write(b'\0' * (offset - f.tell()))
+            f.write(stored)
+
+    total_raw = sum(len(raw) for *_, raw, _ in blobs)
+    total_stored = sum(len(stored) for *_, stored in blobs)
+    compressed = sum(1 for _, flags, *_ in blobs if flags & FLAG_LZ4)
+    print(f'{len(blobs)} ファイル ({compressed} 件をLZ4圧縮) {total_raw // 1024} KB -> {total_stored // 1024} KB を {args.out} にまとめました')
+    return 0
+
+
+def command_list(args):
+    _, (alignment, _, _), entries = read_archive(args.archive)
+    print(f'{len(entries)} ファイル  アライメント {alignment}')
+    for entry in entries:
+        mark = 'LZ4' if entry['flags'] & FLAG_LZ4 else '   '
+        print(f"{entry['offset']:>10}  {entry['stored']:>10}  {entry['size']:>10}  {mark}  {entry['crc']:08x}  {entry['path']}")
+    return 0
+
+
+def command_verify(args):
+    data, (alignment, index_offset, index_size), entries = read_archive(args.archive)
+    errors = 0
+    data_start = index_offset + index_size
+    for entry in entries:
+        path = entry['path']
+        offset = entry['offset']
+        stored = data[offset:offset + entry['stored']]
+
+        problem = None
+        if offset < data_start or offset + entry['stored'] > len(data):
+            problem = '範囲外を指しています'
+        elif offset % alignment != 0:
+            problem = 'アライメントがそろっていません'
+        else:
+            try:
+                raw = lz4_decompress(stored, entry['size']) if entry['flags'] & FLAG_LZ4 else stored
+                if zlib.crc32(raw) & 0xffffffff != entry['crc']:
+                    problem = 'CRCが一致しません'
+                elif args.compare and os.path.exists(path):
+                    with open(path, 'rb') as f:
+                        if f.read() != raw:
+                            problem = 'フォルダのファイルと内容が違います(作り直してください)'
+            except (ValueError, IndexError) as error:
+                problem = f'展開できません({error})'
+
+        if problem:
+            errors += 1
+            print(f'NG  {path}: {problem}')
+
+    print(f'{len(entries)} ファイル中 {errors} 件のエラー')
+    return 1 if errors else 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description='アセットのアーカイブを作成・一覧・検証する')
+    sub = parser.add_subparsers(dest='command', required=True)
+
+    pack = sub.add_parser('pack', help='アーカイブを作る')
+    pack.add_argument('dirs', nargs='*', help='まとめるフォルダ(省略時は data/model などの既定のフォルダ)')
+    pack.add_argument('--out', default='data.pak', help='出力するアーカイブ')
+    pack.add_argument('--align', type=int, default=4096, help='データの先頭をそろえるバイト数')
+    pack.add_argument('--min-saving', type=float, default=0.1, help='これ以上小さくならなければ圧縮しない割合')
+    pack.add_argument('--no-compress', action='store_true', help='LZ4で圧縮しない')
+    pack.add_argument('--skip-converted', action='store_true', help='DDSに変換済みの画像は元の画像を入れない')
+    pack.set_defaults(func=command_pack)
+
+    listing = sub.add_parser('list', help='中身を一覧する')
+    listing.add_argument('archive', nargs='?', default='data.pak')
+    listing.set_defaults(func=command_list)
+
+    verify = sub.add_parser('verify', help='中身を検証する')
+    verify.add_argument('archive', nargs='?', default='data.pak')
+    verify.add_argument('--no-compare', dest='compare', action='store_false', help='フォルダのファイルとは比べない')
+    verify.set_defaults(func=command_verify)
+
+    args = parser.parse_args()
+    return args.func(args)
+
+
+if __name__ == '__main__':
+    sys.exit(main())